@@ -0,0 +1,246 @@
+/*
+Overview of this file:
+
+curry_async(executor, f): returns a curry around f whose saturating applications run f on the executor, returning an async_result
+
+async_function<callable_t, executor_t>: the callable wrapped by curry_async, which binds its arguments and submits the invocation to the executor
+
+async_result<ret_t>: the eventual result of a saturating application, which can be co_await-ed or waited on like a std::future
+
+operator co_await: lets the curry around an async_result be co_await-ed directly
+
+thread_executor, inline_executor: minimal executors, running each job on a new detached thread or immediately on the calling thread
+*/
+
+
+#pragma once
+#include<condition_variable>
+#include<coroutine>
+#include<exception>
+#include<functional>
+#include<memory>
+#include<mutex>
+#include<optional>
+#include<thread>
+#include<type_traits>
+#include<utility>
+#include<variant>
+#include "curry.h"
+
+
+//Runs each job on a new detached std::thread, mostly useful as a default, since a real program would use a thread pool
+struct thread_executor
+{
+	template<typename job_t>
+	void operator()(job_t&& job) const
+	{
+		std::thread(std::forward<job_t>(job)).detach();
+	}
+};
+
+//Runs each job immediately on the thread that submits it, for example to test code written against an executor
+struct inline_executor
+{
+	template<typename job_t>
+	void operator()(job_t&& job) const
+	{
+		std::forward<job_t>(job)();
+	}
+};
+
+//Rather an implementation detail, the state shared between an async_result and the job computing it
+//The job completes it exactly once, with either a value or an exception, and then resumes the awaiting coroutine if there is one
+template<typename ret_t>
+class async_state
+{
+public:
+
+	using stored_t = std::conditional_t<std::is_void_v<ret_t>, std::monostate,
+		std::conditional_t<std::is_lvalue_reference_v<ret_t>, std::reference_wrapper<std::remove_reference_t<ret_t>>, std::remove_cvref_t<ret_t>>>;
+
+	std::mutex lock;
+	std::condition_variable completed;
+	std::optional<stored_t> value;
+	std::exception_ptr error;
+	bool done = false;
+	std::coroutine_handle<> continuation;
+
+	template<typename assign_t>
+	void complete(assign_t&& assign)
+	{
+		std::coroutine_handle<> awaiting;
+		{
+			std::lock_guard guard(lock);
+			std::forward<assign_t>(assign)(*this);
+			done = true;
+			awaiting = std::exchange(continuation, nullptr);
+		}
+		completed.notify_all();
+		if(awaiting)
+		{
+			awaiting.resume();
+		}
+	}
+};
+
+//The result of an application run on an executor, to be retrieved once, either by get() or by co_await
+//A coroutine awaiting it is resumed on whichever thread completes the job, or continues right away if it is already done
+//Exceptions thrown by the invocation are rethrown when the result is retrieved
+template<typename ret_t>
+class async_result
+{
+private:
+
+	std::shared_ptr<async_state<ret_t>> state;
+
+	ret_t take()
+	{
+		if(state->error)
+		{
+			std::rethrow_exception(state->error);
+		}
+		if constexpr (std::is_lvalue_reference_v<ret_t>)
+		{
+			return state->value->get();
+		}
+		else if constexpr (!std::is_void_v<ret_t>)
+		{
+			return static_cast<ret_t>(std::move(*state->value));
+		}
+	}
+
+public:
+
+	explicit async_result(std::shared_ptr<async_state<ret_t>> state) noexcept : state(std::move(state)) {}
+
+	bool ready() const
+	{
+		std::lock_guard guard(state->lock);
+		return state->done;
+	}
+
+	void wait() const
+	{
+		std::unique_lock guard(state->lock);
+		state->completed.wait(guard, [this] { return state->done; });
+	}
+
+	//Blocks until the invocation has finished, then returns (or moves out) its result
+	ret_t get()
+	{
+		wait();
+		return take();
+	}
+
+	bool await_ready() const
+	{
+		return ready();
+	}
+
+	bool await_suspend(std::coroutine_handle<> awaiting)
+	{
+		std::lock_guard guard(state->lock);
+		if(state->done)
+		{
+			return false;
+		}
+		state->continuation = awaiting;
+		return true;
+	}
+
+	ret_t await_resume()
+	{
+		return take();
+	}
+};
+
+//Wraps callable_t so that invoking it submits the invocation to an executor, returning an async_result instead of a result
+//It is invocable with exactly the arguments callable_t is, so curry still binds non-saturating applications synchronously
+//The callable and arguments are decay-copied into the job, following std::bind_front semantics like the rest of curry
+//An executor is anything that can be invoked (as a const lvalue) with a nullary job to run it, possibly on another thread
+template<typename callable_t, typename executor_t>
+class async_function
+{
+private:
+
+	CURRY_NO_UNIQUE_ADDRESS callable_t function;
+	CURRY_NO_UNIQUE_ADDRESS executor_t executor;
+
+	template<typename self_t, typename...args_t>
+	static auto submit(self_t&& self, args_t&&...args)
+	{
+		auto pending = curry<void>::partially_apply(std::forward<self_t>(self).function, std::forward<args_t>(args)...);
+		using ret_t = std::invoke_result_t<decltype(pending)&&>;
+
+		auto state = std::make_shared<async_state<ret_t>>();
+		std::invoke(self.executor, [state, pending = std::move(pending)]() mutable
+			{
+				try
+				{
+					if constexpr (std::is_void_v<ret_t>)
+					{
+						std::invoke(std::move(pending));
+						state->complete([](async_state<ret_t>& s) { s.value.emplace(); });
+					}
+					else
+					{
+						typename async_state<ret_t>::stored_t result(std::invoke(std::move(pending)));
+						state->complete([&result](async_state<ret_t>& s) { s.value.emplace(std::move(result)); });
+					}
+				}
+				catch(...)
+				{
+					state->complete([error = std::current_exception()](async_state<ret_t>& s) { s.error = error; });
+				}
+			});
+		return async_result<ret_t>{std::move(state)};
+	}
+
+public:
+
+	constexpr async_function(executor_t executor, callable_t function)
+		noexcept(std::is_nothrow_move_constructible_v<callable_t> && std::is_nothrow_move_constructible_v<executor_t>) :
+		function(std::move(function)), executor(std::move(executor)) {}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t&, args_t...>
+	auto operator()(args_t&&...args) &
+	{
+		return submit(*this, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const&, args_t...>
+	auto operator()(args_t&&...args) const&
+	{
+		return submit(*this, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t, args_t...>
+	auto operator()(args_t&&...args) &&
+	{
+		return submit(std::move(*this), std::forward<args_t>(args)...);
+	}
+};
+
+//Lets a curry around an async_result, as returned by saturating a curry_async(executor, f), be co_await-ed directly
+template<typename ret_t>
+async_result<ret_t> operator co_await(curry<async_result<ret_t>> result) noexcept
+{
+	return static_cast<async_result<ret_t>&&>(std::move(result));
+}
+
+//async_function<callable_t, executor_t> takes the same number of arguments as callable_t, so it gets the same single step splitting of arguments
+template<typename callable_t, typename executor_t>
+	requires requires { curry<void>::known_arity<callable_t>::value; }
+struct curry<void>::known_arity<async_function<callable_t, executor_t>> : curry<void>::known_arity<callable_t> {};
+
+//Wraps f so that saturating it runs f on the executor and returns a curry around an async_result, instead of the result itself
+//Applications that don't saturate f only bind their arguments, on the calling thread, as usual
+//The executor is copied into every partial application, so it should be a cheap handle, such as a std::ref to a thread pool
+template<typename executor_t, typename callable_t>
+constexpr auto curry_async(executor_t&& executor, callable_t&& f)
+{
+	return curry{async_function<std::decay_t<callable_t>, std::decay_t<executor_t>>{std::forward<executor_t>(executor), std::forward<callable_t>(f)}};
+}
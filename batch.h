@@ -0,0 +1,138 @@
+/*
+Overview of this file:
+
+curry_batch: applies the remaining arguments of a curried function element-wise over one or more (zipped) input ranges, writing to an output range
+Throws std::length_error, before writing anything, if the output range is shorter than the smallest input range
+
+curry_batch with an execution policy: the same, but dispatched through std::for_each with that policy (for example std::execution::par_unseq)
+With libstdc++, the parallel policies are implemented on top of TBB, so programs using them have to be linked with -ltbb
+
+batch_index_iterator: a random access iterator over indices, used to drive the parallel overload of curry_batch
+*/
+
+
+#pragma once
+#include<cstddef>
+#include<execution>
+#include<iterator>
+#include<ranges>
+#include<stdexcept>
+#include<type_traits>
+#include "curry.h"
+#include "uncurry.h"
+
+
+//Rather an implementation detail of curry_batch, since iota_view's iterators are only input iterators to the parallel algorithms
+//Dereferencing returns the index by value, rather than a reference to a member that would dangle along with a temporary iterator (as in *(it + n))
+class batch_index_iterator
+{
+private:
+
+	std::size_t index = 0;
+
+public:
+
+	using iterator_concept = std::random_access_iterator_tag;
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = std::size_t;
+
+	constexpr batch_index_iterator() = default;
+	constexpr explicit batch_index_iterator(std::size_t i) noexcept : index(i) {}
+
+	constexpr reference operator*() const noexcept { return index; }
+	constexpr value_type operator[](difference_type n) const noexcept { return index + n; }
+
+	constexpr batch_index_iterator& operator++() noexcept { ++index; return *this; }
+	constexpr batch_index_iterator operator++(int) noexcept { return batch_index_iterator{index++}; }
+	constexpr batch_index_iterator& operator--() noexcept { --index; return *this; }
+	constexpr batch_index_iterator operator--(int) noexcept { return batch_index_iterator{index--}; }
+	constexpr batch_index_iterator& operator+=(difference_type n) noexcept { index += n; return *this; }
+	constexpr batch_index_iterator& operator-=(difference_type n) noexcept { index -= n; return *this; }
+
+	friend constexpr batch_index_iterator operator+(batch_index_iterator it, difference_type n) noexcept { return it += n; }
+	friend constexpr batch_index_iterator operator+(difference_type n, batch_index_iterator it) noexcept { return it += n; }
+	friend constexpr batch_index_iterator operator-(batch_index_iterator it, difference_type n) noexcept { return it -= n; }
+	friend constexpr difference_type operator-(batch_index_iterator a, batch_index_iterator b) noexcept { return difference_type(a.index - b.index); }
+	friend constexpr auto operator<=>(batch_index_iterator, batch_index_iterator) = default;
+};
+
+//Only used to store the static methods curry_batch is implemented with, without cluttering the global namespace (as curry<void> does for curry)
+struct curry_batch_detail
+{
+	//Assigns the result of applying args to f to out, invoking the hoisted callable directly if args saturate it
+	//Otherwise (for example if the result still needs unit application) the application goes through curry as usual
+	template<typename out_t, typename callable_t, typename...args_t>
+	static constexpr void assign(out_t&& out, curry<callable_t> const& f, callable_t const& hoisted, args_t&&...args)
+	{
+		if constexpr (curry<void>::find_saturation_point<callable_t const&, args_t...>() == sizeof...(args_t))
+		{
+			static_assert(!std::is_void_v<std::invoke_result_t<callable_t const&, args_t...>>, "curry_batch writes the results of f to out, so f can't return void");
+			std::forward<out_t>(out) = std::invoke(hoisted, std::forward<args_t>(args)...);
+		}
+		else
+		{
+			static_assert(!std::is_void_v<decltype(f(std::declval<args_t>()...))>, "curry_batch writes the results of f to out, so f can't return void");
+			std::forward<out_t>(out) = uncurry(f(std::forward<args_t>(args)...));
+		}
+	}
+
+	//The number of applications, which is the size of the smallest input range
+	//Checked against the size of out up front, so that nothing is written past its end, not even by the parallel overload
+	template<typename out_range_t, typename...in_ranges_t>
+	static constexpr std::size_t checked_size(out_range_t&& out, in_ranges_t&&...ins)
+	{
+		std::size_t count = std::size_t(-1);
+		((count = std::size_t(std::ranges::size(ins)) < count ? std::size_t(std::ranges::size(ins)) : count), ...);
+
+		if(std::size_t(std::ranges::size(out)) < count)
+		{
+			throw std::length_error("curry_batch: the output range is shorter than the smallest input range");
+		}
+		return count;
+	}
+};
+
+//Equivalent to out[i] = f(ins[i]...) for each i up to the size of the smallest input range, returning the end of what was written
+//The callable is hoisted out of the loop and, when the inputs saturate it, is invoked directly without any curry in between
+//This leaves a plain indexed loop over the ranges, which the compiler can vectorize when the callable allows it
+//The output range must be at least as long as the smallest input range, or std::length_error is thrown
+template<typename callable_t, std::ranges::random_access_range out_range_t, std::ranges::random_access_range...in_ranges_t>
+	requires std::ranges::sized_range<out_range_t> && (sizeof...(in_ranges_t) > 0) && (std::ranges::sized_range<in_ranges_t> && ...)
+constexpr auto curry_batch(curry<callable_t> const& f, out_range_t&& out, in_ranges_t&&...ins)
+{
+	std::size_t const count = curry_batch_detail::checked_size(out, ins...);
+	callable_t const& hoisted = uncurry(f);
+	auto const out_begin = std::ranges::begin(out);
+
+	[&, ...in_begins = std::ranges::begin(ins)]()
+	{
+		for(std::size_t i = 0; i != count; ++i)
+		{
+			curry_batch_detail::assign(out_begin[i], f, hoisted, in_begins[i]...);
+		}
+	}();
+
+	return out_begin + count;
+}
+
+//Like curry_batch, but the loop is run by std::for_each with the given execution policy, such as std::execution::par_unseq
+//As with any parallel algorithm, applications of f must then be safe to run concurrently (or unsequenced)
+template<typename policy_t, typename callable_t, std::ranges::random_access_range out_range_t, std::ranges::random_access_range...in_ranges_t>
+	requires std::is_execution_policy_v<std::remove_cvref_t<policy_t>> && std::ranges::sized_range<out_range_t> && (sizeof...(in_ranges_t) > 0) && (std::ranges::sized_range<in_ranges_t> && ...)
+auto curry_batch(policy_t&& policy, curry<callable_t> const& f, out_range_t&& out, in_ranges_t&&...ins)
+{
+	std::size_t const count = curry_batch_detail::checked_size(out, ins...);
+	callable_t const& hoisted = uncurry(f);
+	auto const out_begin = std::ranges::begin(out);
+
+	std::for_each(std::forward<policy_t>(policy), batch_index_iterator{0}, batch_index_iterator{count},
+		[&, ...in_begins = std::ranges::begin(ins)](std::size_t i)
+		{
+			curry_batch_detail::assign(out_begin[i], f, hoisted, in_begins[i]...);
+		});
+
+	return out_begin + count;
+}
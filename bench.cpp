@@ -0,0 +1,142 @@
+/*
+Runtime microbenchmarks comparing curry against a direct call, std::bind_front, and a hand written lambda
+Build with optimizations, for example: c++ -std=c++20 -O2 bench.cpp -o bench
+Run as: ./bench [iterations]
+
+Each case calls a three argument function in a hot loop, with arguments read from arrays so that nothing is constant folded
+The trivial cases use ints, the heavy cases use a type with a std::string and std::vector, which is costly to copy
+*/
+
+#include<chrono>
+#include<cstdio>
+#include<cstdlib>
+#include<string>
+#include<vector>
+#include"curry.h"
+
+//Forces value to be computed, without the cost of actually storing it anywhere
+template<typename t>
+inline void do_not_optimize(t const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile t const* sink;
+	sink = &value;
+#endif
+}
+
+constexpr std::size_t input_count = 256;
+
+struct heavy
+{
+	std::string name;
+	std::vector<int> data;
+};
+
+int trivial_f(int a, int b, int c)
+{
+	return a * 3 + b * 2 + c;
+}
+
+int heavy_f(heavy const& a, heavy const& b, int c)
+{
+	return int(a.name.size() + b.data.size()) + a.data[0] + b.data[0] + c;
+}
+
+template<typename body_t>
+void run(char const* name, std::size_t iterations, body_t&& body)
+{
+	body(0); //warm up
+
+	auto start = std::chrono::steady_clock::now();
+	for(std::size_t i = 0; i != iterations; ++i)
+	{
+		do_not_optimize(body(i % input_count));
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	double ns = std::chrono::duration<double, std::nano>(end - start).count() / double(iterations);
+	std::printf("%-44s %10.3f ns/call\n", name, ns);
+}
+
+int main(int argc, char** argv)
+{
+	std::size_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+	std::vector<int> ints(input_count);
+	std::vector<heavy> heavies(input_count);
+	for(std::size_t i = 0; i != input_count; ++i)
+	{
+		ints[i] = std::rand() % 1000;
+		heavies[i] = heavy{std::string(64, char('a' + i % 26)), std::vector<int>(64, int(i))};
+	}
+
+	int const* in = ints.data();
+	heavy const* hv = heavies.data();
+
+	std::printf("trivially copyable arguments:\n");
+	{
+		run("direct f(a,b,c)", iterations, [&](std::size_t i)
+			{ return trivial_f(in[i], in[(i + 1) % input_count], in[(i + 2) % input_count]); });
+
+		auto lambda = [](int a, int b, int c) { return trivial_f(a, b, c); };
+		run("lambda(a,b,c)", iterations, [&](std::size_t i)
+			{ return lambda(in[i], in[(i + 1) % input_count], in[(i + 2) % input_count]); });
+
+		run("std::bind_front(f,a)(b,c)", iterations, [&](std::size_t i)
+			{ return std::bind_front(trivial_f, in[i])(in[(i + 1) % input_count], in[(i + 2) % input_count]); });
+
+		run("curry{f}(a,b,c)", iterations, [&](std::size_t i) -> int
+			{ return curry{trivial_f}(in[i], in[(i + 1) % input_count], in[(i + 2) % input_count]); });
+
+		run("curry{f}(a)(b)(c)", iterations, [&](std::size_t i) -> int
+			{ return curry{trivial_f}(in[i])(in[(i + 1) % input_count])(in[(i + 2) % input_count]); });
+
+		auto prebound_bind = std::bind_front(trivial_f, in[0], in[1]);
+		run("prebound std::bind_front(f,a,b) (c)", iterations, [&](std::size_t i)
+			{ return prebound_bind(in[i]); });
+
+		auto prebound_curry = curry{trivial_f}(in[0], in[1]);
+		run("prebound curry{f}(a,b) (c)", iterations, [&](std::size_t i) -> int
+			{ return prebound_curry(in[i]); });
+
+		auto wrapped = curry{trivial_f};
+		run("lvalue curry (a)(b)(c)", iterations, [&](std::size_t i) -> int
+			{ return wrapped(in[i])(in[(i + 1) % input_count])(in[(i + 2) % input_count]); });
+	}
+
+	std::printf("\nheavy arguments:\n");
+	{
+		run("direct f(a,b,c)", iterations, [&](std::size_t i)
+			{ return heavy_f(hv[i], hv[(i + 1) % input_count], in[i]); });
+
+		auto lambda = [](heavy const& a, heavy const& b, int c) { return heavy_f(a, b, c); };
+		run("lambda(a,b,c)", iterations, [&](std::size_t i)
+			{ return lambda(hv[i], hv[(i + 1) % input_count], in[i]); });
+
+		run("std::bind_front(f,a)(b,c) (copies a)", iterations, [&](std::size_t i)
+			{ return std::bind_front(heavy_f, hv[i])(hv[(i + 1) % input_count], in[i]); });
+
+		run("curry{f}(a,b,c)", iterations, [&](std::size_t i) -> int
+			{ return curry{heavy_f}(hv[i], hv[(i + 1) % input_count], in[i]); });
+
+		run("curry{f}(a)(b)(c) (copies a and b)", iterations, [&](std::size_t i) -> int
+			{ return curry{heavy_f}(hv[i])(hv[(i + 1) % input_count])(in[i]); });
+
+		run("curry{f}(cref(a))(cref(b))(c)", iterations, [&](std::size_t i) -> int
+			{ return curry{heavy_f}(std::cref(hv[i]))(std::cref(hv[(i + 1) % input_count]))(in[i]); });
+
+		auto prebound_bind = std::bind_front(heavy_f, hv[0], hv[1]);
+		run("prebound std::bind_front(f,a,b) (c)", iterations, [&](std::size_t i)
+			{ return prebound_bind(in[i]); });
+
+		auto prebound_curry = curry{heavy_f}(hv[0], hv[1]);
+		run("prebound curry{f}(a,b) (c)", iterations, [&](std::size_t i) -> int
+			{ return prebound_curry(in[i]); });
+
+		auto wrapped = curry{heavy_f};
+		run("lvalue curry (a)(b)(c)", iterations, [&](std::size_t i) -> int
+			{ return wrapped(hv[i])(hv[(i + 1) % input_count])(in[i]); });
+	}
+}
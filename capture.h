@@ -0,0 +1,89 @@
+/*
+Overview of this file:
+
+curry_by_reference<max_copy_size>(f): returns a curry around f which binds lvalue arguments by reference when they are big or not trivially copyable
+
+capture_by_reference<callable_t, max_copy_size>: the callable wrapped by curry_by_reference, which is invoked exactly like callable_t
+
+is_captured_by_reference_v: whether an argument of a particular type is bound by reference under a particular max_copy_size
+*/
+
+
+#pragma once
+#include<cstddef>
+#include<functional>
+#include<type_traits>
+#include<utility>
+#include "curry.h"
+
+
+//Wraps callable_t without changing how it is invoked, but changes how arguments are bound to it (or to its partial applications)
+//Lvalue arguments which are bigger than max_copy_size or aren't trivially copyable are bound as if they were passed through std::ref/std::cref
+//Small trivially copyable lvalues, as well as all rvalues, are still decay-copied (or moved) into the partial application as usual
+//So, as with std::ref, the referenced arguments have to outlive the partial applications they are bound to
+template<typename callable_t, std::size_t max_copy_size>
+class capture_by_reference
+{
+private:
+
+	CURRY_NO_UNIQUE_ADDRESS callable_t function;
+
+public:
+
+	constexpr explicit capture_by_reference(callable_t function) noexcept(std::is_nothrow_move_constructible_v<callable_t>) : function(std::move(function)) {}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t&, args_t...>
+	constexpr decltype(auto) operator()(args_t&&...args) & noexcept(curry<void>::is_nothrow_callable_v<callable_t&, args_t...>)
+	{
+		return std::invoke(function, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const&, args_t...>
+	constexpr decltype(auto) operator()(args_t&&...args) const& noexcept(curry<void>::is_nothrow_callable_v<callable_t const&, args_t...>)
+	{
+		return std::invoke(function, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t, args_t...>
+	constexpr decltype(auto) operator()(args_t&&...args) && noexcept(curry<void>::is_nothrow_callable_v<callable_t, args_t...>)
+	{
+		return std::invoke(std::move(function), std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const, args_t...>
+	constexpr decltype(auto) operator()(args_t&&...args) const&& noexcept(curry<void>::is_nothrow_callable_v<callable_t const, args_t...>)
+	{
+		return std::invoke(std::move(function), std::forward<args_t>(args)...);
+	}
+};
+
+//Whether an argument of type arg_t bound to a capture_by_reference<..., max_copy_size> is stored by reference
+template<typename arg_t, std::size_t max_copy_size>
+constexpr bool is_captured_by_reference_v = std::is_lvalue_reference_v<arg_t> && std::is_object_v<std::remove_reference_t<arg_t>> &&
+	!std::is_array_v<std::remove_reference_t<arg_t>> &&
+	(sizeof(std::remove_reference_t<arg_t>) > max_copy_size || !std::is_trivially_copyable_v<std::remove_reference_t<arg_t>>);
+
+template<typename callable_t, std::size_t max_copy_size>
+struct curry<void>::bound_argument<capture_by_reference<callable_t, max_copy_size>>
+{
+	template<typename arg_t>
+	using type = std::conditional_t<is_captured_by_reference_v<arg_t, max_copy_size>,
+		std::reference_wrapper<std::remove_reference_t<arg_t>>, std::decay_t<arg_t>>;
+};
+
+//capture_by_reference<callable_t, max_copy_size> takes the same number of arguments as callable_t, so it gets the same single step splitting of arguments
+template<typename callable_t, std::size_t max_copy_size>
+	requires requires { curry<void>::known_arity<callable_t>::value; }
+struct curry<void>::known_arity<capture_by_reference<callable_t, max_copy_size>> : curry<void>::known_arity<callable_t> {};
+
+//Wraps f so that lvalue arguments bound to it, and to its partial applications, are captured by reference if copying them could be expensive
+//Arguments are captured by reference if they are bigger than max_copy_size bytes (by default two pointers) or not trivially copyable
+template<std::size_t max_copy_size = 2 * sizeof(void*), typename callable_t>
+constexpr auto curry_by_reference(callable_t&& f)
+{
+	return curry{capture_by_reference<std::decay_t<callable_t>, max_copy_size>{std::forward<callable_t>(f)}};
+}
@@ -0,0 +1,83 @@
+/*
+Reference cases for codegen_check.sh, which compiles this file to assembly and checks that each codegen_curry_* function
+compiles to exactly the same instructions as the matching codegen_direct_* function
+This file is only ever compiled to assembly, so codegen_target is never defined
+*/
+
+#include"curry.h"
+
+extern "C" int codegen_target(int a, int b, int c);
+
+constexpr auto stateless = [](int a, int b, int c) { return a * 3 + b * 2 + c; };
+
+using target_t = int(*)(int, int, int);
+
+
+//A stateless lambda, applied one argument at a time
+
+extern "C" int codegen_direct_stateless(int x, int y, int z)
+{
+	return stateless(x, y, z);
+}
+
+extern "C" int codegen_curry_stateless(int x, int y, int z)
+{
+	return curry{stateless}(x)(y)(z);
+}
+
+
+//A function pointer known at compile time, applied one argument at a time and all at once
+
+extern "C" int codegen_direct_pointer(int x, int y, int z)
+{
+	return codegen_target(x, y, z);
+}
+
+extern "C" int codegen_curry_pointer(int x, int y, int z)
+{
+	return curry{&codegen_target}(x)(y)(z);
+}
+
+extern "C" int codegen_curry_pointer_all(int x, int y, int z)
+{
+	return curry{&codegen_target}(x, y, z);
+}
+
+
+//A function pointer only known at runtime, going through the lvalue path of curry<t>::operator() &, which copies it
+
+extern "C" int codegen_direct_lvalue(target_t& f, int x, int y, int z)
+{
+	return f(x, y, z);
+}
+
+extern "C" int codegen_curry_lvalue(curry<target_t>& f, int x, int y, int z)
+{
+	return f(x)(y)(z);
+}
+
+
+//A stateless lambda through the lvalue path
+
+extern "C" int codegen_direct_lvalue_stateless(decltype(stateless) const& f, int x, int y, int z)
+{
+	return f(x, y, z);
+}
+
+extern "C" int codegen_curry_lvalue_stateless(curry<decltype(stateless)> const& f, int x, int y, int z)
+{
+	return f(x)(y)(z);
+}
+
+
+//Arguments bound out of order with placeholders, which are filled in at compile time
+
+extern "C" int codegen_curry_pointer_placeholders(int x, int y, int z)
+{
+	return curry{&codegen_target}(curry_placeholders::_, y)(curry_placeholders::_, z)(x);
+}
+
+extern "C" int codegen_curry_stateless_placeholders(int x, int y, int z)
+{
+	return curry{stateless}(curry_placeholders::_, curry_placeholders::_, z)(x, y);
+}
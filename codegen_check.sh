@@ -0,0 +1,67 @@
+#!/bin/sh
+# Checks that curried calls compile to the same machine code as direct calls
+# Every codegen_curry_<case>[_<variant>] function in codegen.cpp is compared against codegen_direct_<case>
+# Usage: ./codegen_check.sh (exits with a nonzero status if any case differs)
+#
+# Environment variables:
+#   CXX: the compiler to check (default c++), which may be gcc, clang, or MSVC's cl
+#   CXXFLAGS: extra flags for the compilation, in addition to -O2 (or /O2)
+
+cd "$(dirname "$0")" || exit 1
+
+CXX=${CXX:-c++}
+WORK_DIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+case "$(basename "$CXX")" in
+	cl|cl.exe)
+		# shellcheck disable=SC2086
+		"$CXX" /nologo /std:c++20 /O2 /c /FA $CXXFLAGS /Fa"$WORK_DIR/codegen.asm" /Fo"$WORK_DIR/codegen.obj" codegen.cpp >/dev/null || exit 1
+		ASM=$WORK_DIR/codegen.asm
+		STYLE=msvc
+		;;
+	*)
+		# shellcheck disable=SC2086
+		"$CXX" -std=c++20 -O2 -S -fno-asynchronous-unwind-tables $CXXFLAGS -o "$WORK_DIR/codegen.s" codegen.cpp || exit 1
+		ASM=$WORK_DIR/codegen.s
+		STYLE=gnu
+		;;
+esac
+
+# body name: prints the instructions of a function, with directives removed and local labels normalized
+body()
+{
+	awk -v name="$1" -v style="$STYLE" '
+		style == "gnu" && $0 ~ "^_?" name ":" { inside = 1; next }
+		style == "msvc" && $1 == name && $2 == "PROC" { inside = 1; next }
+		!inside { next }
+		style == "gnu" && ($1 == ".size" || $1 == ".cfi_endproc") { exit }
+		style == "msvc" && $1 == name && $2 == "ENDP" { exit }
+		/^[ \t]*\./ && !/^[ \t]*\.L[A-Za-z0-9_]*:/ { next }
+		/^[ \t]*;/ || /^[ \t]*$/ { next }
+		{ gsub(/\.L[A-Za-z0-9_]+/, ".L"); gsub(/\$LN[0-9]+@[A-Za-z0-9_]+/, "$LN"); sub(/[ \t]*;.*$/, ""); print }
+	' "$ASM"
+}
+
+status=0
+for curried in $(grep -o 'int codegen_curry_[A-Za-z0-9_]*(' codegen.cpp | sed 's/^int //' | tr -d '(' | sort -u); do
+	case_name=${curried#codegen_curry_}
+	direct=codegen_direct_$case_name
+	[ "$(body "$direct")" = "" ] && direct=codegen_direct_${case_name%_*}
+
+	body "$direct" > "$WORK_DIR/direct.txt"
+	body "$curried" > "$WORK_DIR/curried.txt"
+
+	if [ ! -s "$WORK_DIR/curried.txt" ] || [ ! -s "$WORK_DIR/direct.txt" ]; then
+		echo "MISSING $curried or $direct in the generated assembly"
+		status=1
+	elif cmp -s "$WORK_DIR/direct.txt" "$WORK_DIR/curried.txt"; then
+		echo "ok      $curried ($(wc -l < "$WORK_DIR/curried.txt" | tr -d ' ') lines)"
+	else
+		echo "DIFFERS $curried from $direct:"
+		diff "$WORK_DIR/direct.txt" "$WORK_DIR/curried.txt" | sed 's/^/    /'
+		status=1
+	fi
+done
+
+exit $status
@@ -0,0 +1,126 @@
+/*
+A translation unit for measuring the compile-time cost of curry.h and curried.h
+It is meant to be compiled repeatedly by compile_bench.sh (with -fsyntax-only), rather than to be run
+
+Configured via macros:
+
+CURRY_BENCH_ARITY: the number of parameters of the generated functions (1 through 64)
+
+CURRY_BENCH_FUNCTIONS: the number of distinct generated functions, so that the cost isn't hidden by memoized instantiations
+
+CURRY_BENCH_PATTERN: how arguments are applied to each function, one of:
+	0: all at once, curry{f}(a,b,c,...)
+	1: one at a time, curry{f}(a)(b)(c)...
+	2: mixed, in groups of increasing size, curry{f}(a)(b,c)(d,e,f)...
+	3: bound by the deduction guide of the multiple-argument constructor, curry{f,a,b,c,...}
+	4: checked with the curried concept, curried<decltype(curry{f}),int,int,int,...>
+
+CURRY_BENCH_GENERIC: if nonzero, the functions are generic lambdas, so their arity can't be read from their type
+*/
+
+#include<utility>
+#include"currying.h"
+
+#ifndef CURRY_BENCH_ARITY
+#define CURRY_BENCH_ARITY 8
+#endif
+
+#ifndef CURRY_BENCH_FUNCTIONS
+#define CURRY_BENCH_FUNCTIONS 16
+#endif
+
+#ifndef CURRY_BENCH_PATTERN
+#define CURRY_BENCH_PATTERN 0
+#endif
+
+#ifndef CURRY_BENCH_GENERIC
+#define CURRY_BENCH_GENERIC 0
+#endif
+
+constexpr std::size_t arity = CURRY_BENCH_ARITY;
+
+template<std::size_t>
+using arg_t = int;
+
+//nary<id>::get() is a distinct function of arity parameters for each id
+template<std::size_t id, typename = std::make_index_sequence<arity>>
+struct nary;
+
+template<std::size_t id, std::size_t...is>
+struct nary<id, std::index_sequence<is...>>
+{
+	static constexpr int call(arg_t<is>...args)
+	{
+		return (int(id) + ... + args);
+	}
+
+	static constexpr auto get()
+	{
+		if constexpr (CURRY_BENCH_GENERIC != 0)
+		{
+			return [](auto...args) requires (sizeof...(args) == arity) { return (int(id) + ... + args); };
+		}
+		else
+		{
+			return &call;
+		}
+	}
+};
+
+//Applies the arguments from first onwards in groups of group_size, then group_size + step, and so on
+template<std::size_t first, std::size_t group_size, std::size_t step, typename curried_t>
+constexpr int apply_groups(curried_t&& f)
+{
+	if constexpr (first >= arity)
+	{
+		return std::forward<curried_t>(f);
+	}
+	else
+	{
+		constexpr std::size_t size = first + group_size > arity ? arity - first : group_size;
+		return [&]<std::size_t...is>(std::index_sequence<is...>)
+		{
+			return apply_groups<first + size, group_size + step, step>(std::forward<curried_t>(f)(int(first + is)...));
+		}(std::make_index_sequence<size>{});
+	}
+}
+
+template<std::size_t id, std::size_t...is>
+constexpr int bench_one(std::index_sequence<is...>)
+{
+	constexpr auto f = nary<id>::get();
+
+	if constexpr (CURRY_BENCH_PATTERN == 0)
+	{
+		return curry{f}(int(is)...);
+	}
+	else if constexpr (CURRY_BENCH_PATTERN == 1)
+	{
+		return apply_groups<0, 1, 0>(curry{f});
+	}
+	else if constexpr (CURRY_BENCH_PATTERN == 2)
+	{
+		return apply_groups<0, 1, 1>(curry{f});
+	}
+	else if constexpr (CURRY_BENCH_PATTERN == 3)
+	{
+		return curry{f, int(is)...};
+	}
+	else
+	{
+		static_assert(curried<decltype(curry{f}), int, arg_t<is>...>);
+		return 0;
+	}
+}
+
+template<std::size_t...ids>
+constexpr int bench_all(std::index_sequence<ids...>)
+{
+	return (0 + ... + bench_one<ids>(std::make_index_sequence<arity>{}));
+}
+
+int main()
+{
+	volatile int sink = bench_all(std::make_index_sequence<CURRY_BENCH_FUNCTIONS>{});
+	(void)sink;
+}
@@ -0,0 +1,118 @@
+#!/bin/sh
+# Measures the compile-time cost of curry.h and curried.h by compiling compile_bench.cpp in every configuration
+# Usage: ./compile_bench.sh [arity...] (defaulting to 1 2 4 8 16 32 64)
+#
+# Environment variables:
+#   CXX: the compiler to measure (default c++), gcc and clang style flags are assumed
+#   CXXFLAGS: extra flags for every compilation
+#   CURRY_BENCH_FUNCTIONS: the number of distinct functions generated per compilation (default 16)
+#   CURRY_BENCH_DEPTH: set to 0 to skip searching for the smallest -ftemplate-depth that compiles, which is slow
+#   CURRY_BENCH_TIMEOUT: the seconds each compilation may take before it is killed (default 300, 0 for no limit), needs timeout from coreutils
+#
+# Prints csv to stdout with the columns:
+#   pattern: see compile_bench.cpp (all, one, mixed, guide, concept)
+#   generic: 1 for generic lambdas, 0 for function pointers
+#   arity, seconds: wall clock time of the front end (-fsyntax-only)
+#   depth: the smallest -ftemplate-depth that compiles
+#   instantiations: template instantiations recorded by clang's -ftime-trace (empty for other compilers)
+# Configurations that fail or time out print failed or timeout in the seconds column, followed by the compiler's errors on stderr
+# The exit status is nonzero if any of them did
+
+cd "$(dirname "$0")" || exit 1
+
+CXX=${CXX:-c++}
+CURRY_BENCH_FUNCTIONS=${CURRY_BENCH_FUNCTIONS:-16}
+CURRY_BENCH_DEPTH=${CURRY_BENCH_DEPTH:-1}
+CURRY_BENCH_TIMEOUT=${CURRY_BENCH_TIMEOUT:-300}
+ARITIES=${*:-1 2 4 8 16 32 64}
+TRACE_DIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$TRACE_DIR"' EXIT
+
+LIMIT=""
+if [ "$CURRY_BENCH_TIMEOUT" != 0 ]; then
+	if command -v timeout >/dev/null 2>&1; then
+		LIMIT="timeout $CURRY_BENCH_TIMEOUT"
+	else
+		echo "compile_bench.sh: timeout not found, compiling without a time limit" >&2
+	fi
+fi
+FAILURES=0
+
+IS_CLANG=0
+"$CXX" --version 2>/dev/null | grep -qi clang && IS_CLANG=1
+
+now_ns()
+{
+	date +%s%N
+}
+
+# compile pattern generic arity [extra flags...]: the status is 124 if it timed out, and the errors are left in $TRACE_DIR/errors.txt
+compile()
+{
+	pattern=$1 generic=$2 arity=$3
+	shift 3
+	# shellcheck disable=SC2086
+	$LIMIT "$CXX" -std=c++20 -fsyntax-only $CXXFLAGS \
+		-DCURRY_BENCH_PATTERN="$pattern" -DCURRY_BENCH_GENERIC="$generic" -DCURRY_BENCH_ARITY="$arity" \
+		-DCURRY_BENCH_FUNCTIONS="$CURRY_BENCH_FUNCTIONS" "$@" compile_bench.cpp >/dev/null 2>"$TRACE_DIR/errors.txt"
+}
+
+# min_depth pattern generic arity: binary search for the smallest template depth limit that still compiles
+min_depth()
+{
+	low=1 high=4096
+	compile "$1" "$2" "$3" -ftemplate-depth=$high || { echo ">$high"; return; }
+	while [ $low -lt $high ]; do
+		mid=$(( (low + high) / 2 ))
+		if compile "$1" "$2" "$3" -ftemplate-depth=$mid; then high=$mid; else low=$(( mid + 1 )); fi
+	done
+	echo $low
+}
+
+echo "pattern,generic,arity,seconds,depth,instantiations"
+
+for arity in $ARITIES; do
+	for generic in 0 1; do
+		pattern=0
+		for name in all one mixed guide concept; do
+			trace=""
+			if [ $IS_CLANG -eq 1 ]; then
+				set -- -ftime-trace="$TRACE_DIR/trace.json" -ftime-trace-granularity=0
+			else
+				set --
+			fi
+
+			start=$(now_ns)
+			compile $pattern $generic "$arity" "$@"
+			status=$?
+			if [ $status -eq 0 ]; then
+				end=$(now_ns)
+				seconds=$(awk "BEGIN { printf \"%.3f\", ($end - $start) / 1e9 }")
+				if [ $IS_CLANG -eq 1 ] && [ -f "$TRACE_DIR/trace.json" ]; then
+					trace=$(grep -o '"name":"Instantiate\(Function\|Class\)"' "$TRACE_DIR/trace.json" | wc -l | tr -d ' ')
+				fi
+				depth=""
+				[ "$CURRY_BENCH_DEPTH" != 0 ] && depth=$(min_depth $pattern $generic "$arity")
+				echo "$name,$generic,$arity,$seconds,$depth,$trace"
+			else
+				FAILURES=$(( FAILURES + 1 ))
+				if [ $status -eq 124 ]; then
+					echo "$name,$generic,$arity,timeout,,"
+					echo "compile_bench.sh: $name (generic $generic, arity $arity) timed out after $CURRY_BENCH_TIMEOUT seconds" >&2
+				else
+					echo "$name,$generic,$arity,failed,,"
+					echo "compile_bench.sh: $name (generic $generic, arity $arity) failed to compile:" >&2
+					head -n 20 "$TRACE_DIR/errors.txt" >&2
+				fi
+			fi
+
+			rm -f "$TRACE_DIR/trace.json"
+			pattern=$(( pattern + 1 ))
+		done
+	done
+done
+
+if [ $FAILURES -ne 0 ]; then
+	echo "compile_bench.sh: $FAILURES configurations failed or timed out" >&2
+	exit 1
+fi
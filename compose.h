@@ -0,0 +1,200 @@
+/*
+Overview of this file:
+
+compose(f, g, hs...): returns a curry around the composition of f, g and hs, which applies g to the result of f, and so on
+
+f | g: the composition of two curries, equivalent to compose(f, g)
+
+composition<stages_t...>: the callable wrapped by compose, which runs all of its stages in a single invocation
+
+is_composition: whether a type is an instance of composition
+*/
+
+
+#pragma once
+#include<cstddef>
+#include<functional>
+#include<type_traits>
+#include<utility>
+#include "curry.h"
+#include "uncurry.h"
+
+
+//Invokes its first stage with its arguments, then each later stage with the result of the stage before it, returning the result of the last one
+//The results in between are passed straight from one stage to the next, rather than each being wrapped up by a curry and converted back out of it
+//Stages are held in one curry<void>::packed_storage, so a composition of stateless callables is empty
+//It takes the arguments of its first stage, so currying it partially applies the first stage, and the rest of the chain runs once that saturates
+//Later stages are invoked directly rather than curried, so they have to take the result of the stage before them as their only argument
+template<typename first_t, typename...stages_t>
+class composition
+{
+private:
+
+	template<typename...ts>
+	using storage_t = curry<void>::packed_storage<std::index_sequence_for<ts...>, ts...>;
+
+	CURRY_NO_UNIQUE_ADDRESS storage_t<first_t, stages_t...> storage;
+
+	static constexpr std::size_t count = 1 + sizeof...(stages_t);
+
+	//Whether invoking the stages from the i-th one on, starting with args, is well formed (and is noexcept if is_nothrow is set)
+	//self_t is a possibly qualified storage_t, which the stages are taken from with the same qualifiers
+	template<std::size_t i, bool is_nothrow, typename self_t, typename...args_t>
+	static constexpr bool is_invocable_from()
+	{
+		using stage_t = decltype(std::declval<self_t>().template get<i>());
+
+		if constexpr (!std::is_invocable_v<stage_t, args_t...>)
+		{
+			return false;
+		}
+		else if constexpr (is_nothrow && !curry<void>::is_nothrow_callable_v<stage_t, args_t...>)
+		{
+			return false;
+		}
+		else if constexpr (i + 1 == count)
+		{
+			return true;
+		}
+		else
+		{
+			return is_invocable_from<i + 1, is_nothrow, self_t, std::invoke_result_t<stage_t, args_t...>>();
+		}
+	}
+
+	template<std::size_t i, typename self_t, typename...args_t>
+	static constexpr decltype(auto) invoke_from(self_t&& self, args_t&&...args)
+	{
+		if constexpr (i + 1 == count)
+		{
+			return std::invoke(std::forward<self_t>(self).template get<i>(), std::forward<args_t>(args)...);
+		}
+		else
+		{
+			return invoke_from<i + 1>(std::forward<self_t>(self), std::invoke(std::forward<self_t>(self).template get<i>(), std::forward<args_t>(args)...));
+		}
+	}
+
+	template<typename self_t, typename next_t, std::size_t...is>
+	static constexpr auto append_stage(self_t&& self, next_t&& next, std::index_sequence<is...>)
+	{
+		return composition<first_t, stages_t..., std::decay_t<next_t>>{std::in_place, std::forward<self_t>(self).storage.template get<is>()..., std::forward<next_t>(next)};
+	}
+
+public:
+
+	template<typename c_first_t, typename...c_stages_t>
+	constexpr composition(std::in_place_t, c_first_t&& first, c_stages_t&&...stages)
+		noexcept(std::is_nothrow_constructible_v<first_t, c_first_t> && (std::is_nothrow_constructible_v<stages_t, c_stages_t> && ...)) :
+		storage(std::in_place, std::forward<c_first_t>(first), std::forward<c_stages_t>(stages)...) {}
+
+	template<typename...args_t>
+		requires (is_invocable_from<0, false, storage_t<first_t, stages_t...>&, args_t...>())
+	constexpr decltype(auto) operator()(args_t&&...args) & noexcept(is_invocable_from<0, true, storage_t<first_t, stages_t...>&, args_t...>())
+	{
+		return invoke_from<0>(storage, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires (is_invocable_from<0, false, storage_t<first_t, stages_t...> const&, args_t...>())
+	constexpr decltype(auto) operator()(args_t&&...args) const& noexcept(is_invocable_from<0, true, storage_t<first_t, stages_t...> const&, args_t...>())
+	{
+		return invoke_from<0>(storage, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires (is_invocable_from<0, false, storage_t<first_t, stages_t...>, args_t...>())
+	constexpr decltype(auto) operator()(args_t&&...args) && noexcept(is_invocable_from<0, true, storage_t<first_t, stages_t...>, args_t...>())
+	{
+		return invoke_from<0>(std::move(storage), std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires (is_invocable_from<0, false, storage_t<first_t, stages_t...> const, args_t...>())
+	constexpr decltype(auto) operator()(args_t&&...args) const&& noexcept(is_invocable_from<0, true, storage_t<first_t, stages_t...> const, args_t...>())
+	{
+		return invoke_from<0>(std::move(storage), std::forward<args_t>(args)...);
+	}
+
+	//Produces a composition with next run after the stages already held, copying or moving from *this, rather than nesting *this in another layer
+	template<typename next_t>
+	constexpr auto then(next_t&& next) const&
+	{
+		return append_stage(*this, std::forward<next_t>(next), std::make_index_sequence<count>{});
+	}
+
+	template<typename next_t>
+	constexpr auto then(next_t&& next) &&
+	{
+		return append_stage(std::move(*this), std::forward<next_t>(next), std::make_index_sequence<count>{});
+	}
+};
+
+//Arguments bound to a composition are arguments of its first stage, so they are stored however the first stage would store them
+template<typename first_t, typename...stages_t>
+struct curry<void>::bound_argument<composition<first_t, stages_t...>> : curry<void>::bound_argument<first_t> {};
+
+//A composition takes the same arguments as its first stage, so it gets the same single step splitting of arguments
+template<typename first_t, typename...stages_t>
+	requires requires { curry<void>::known_arity<first_t>::value; }
+struct curry<void>::known_arity<composition<first_t, stages_t...>> : curry<void>::known_arity<first_t> {};
+
+template<typename t>
+struct is_composition : std::false_type {};
+
+template<typename first_t, typename...stages_t>
+struct is_composition<composition<first_t, stages_t...>> : std::true_type {};
+
+//Returns a curry around the composition of f, g and hs, which applies f to its arguments, then g to the result of that, and so on
+//Any of them may be curries, in which case the callables they wrap are used, and if f is already a curry of a composition, g and hs are appended to it
+//Currying the result partially applies f, so compose(f, g)(x)(y) is g(f(x, y)) for an f taking two arguments
+template<typename f_t, typename g_t, typename...hs_t>
+constexpr auto compose(f_t&& f, g_t&& g, hs_t&&...hs)
+{
+	if constexpr (requires { typename uncurried<std::remove_cvref_t<f_t>>::type; })
+	{
+		return compose(uncurry(std::forward<f_t>(f)), std::forward<g_t>(g), std::forward<hs_t>(hs)...);
+	}
+	else if constexpr (requires { typename uncurried<std::remove_cvref_t<g_t>>::type; })
+	{
+		return compose(std::forward<f_t>(f), uncurry(std::forward<g_t>(g)), std::forward<hs_t>(hs)...);
+	}
+	else if constexpr (sizeof...(hs_t) != 0)
+	{
+		return compose(uncurry(compose(std::forward<f_t>(f), std::forward<g_t>(g))), std::forward<hs_t>(hs)...);
+	}
+	else if constexpr (is_composition<std::remove_cvref_t<f_t>>::value)
+	{
+		return curry{std::forward<f_t>(f).then(std::forward<g_t>(g))};
+	}
+	else
+	{
+		return curry{composition<std::decay_t<f_t>, std::decay_t<g_t>>{std::in_place, std::forward<f_t>(f), std::forward<g_t>(g)}};
+	}
+}
+
+//f | g is compose(f, g), and since it associates to the left, f | g | h is a single composition of all three
+//Only defined for curries, so it doesn't take over the | of any other types
+template<typename f_t, typename g_t>
+constexpr auto operator|(curry<f_t> const& f, curry<g_t> const& g)
+{
+	return compose(f, g);
+}
+
+template<typename f_t, typename g_t>
+constexpr auto operator|(curry<f_t>&& f, curry<g_t> const& g)
+{
+	return compose(std::move(f), g);
+}
+
+template<typename f_t, typename g_t>
+constexpr auto operator|(curry<f_t> const& f, curry<g_t>&& g)
+{
+	return compose(f, std::move(g));
+}
+
+template<typename f_t, typename g_t>
+constexpr auto operator|(curry<f_t>&& f, curry<g_t>&& g)
+{
+	return compose(std::move(f), std::move(g));
+}
@@ -0,0 +1,179 @@
+/*
+Overview of this file:
+
+bind_constants<values...>(f): returns a curry around f with values bound as its first arguments, stored as template parameters rather than as members
+If values... saturate f, it is invoked right away instead, as with curry{f}(values...)
+If only the first few of them do, f is invoked with those, and the rest are bound to its result in the same way
+
+constant_application<callable_t, values...>: the callable wrapped by bind_constants, which invokes callable_t with values followed by its own arguments
+
+is_constant_application: whether a type is an instance of constant_application
+*/
+
+
+#pragma once
+#include<cstddef>
+#include<functional>
+#include<tuple>
+#include<type_traits>
+#include<utility>
+#include "curry.h"
+#include "uncurry.h"
+
+
+//Invokes callable_t with values... bound in front of its own arguments, like a partial application of callable_t to values...
+//Since the values are template parameters, they take up no space, so this is exactly the size of callable_t (and empty if it is)
+//They are also passed as constants, so the optimizer sees them at every call site without having to track them through the object
+//Each value is passed as a prvalue, so callable_t sees a fresh copy on every invocation, just as if it had been written at the call site
+template<typename callable_t, auto...values>
+class constant_application
+{
+private:
+
+	CURRY_NO_UNIQUE_ADDRESS callable_t function;
+
+public:
+
+	constexpr explicit constant_application(callable_t function) noexcept(std::is_nothrow_move_constructible_v<callable_t>) : function(std::move(function)) {}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t&, decltype(values)..., args_t...>
+	constexpr decltype(auto) operator()(args_t&&...args) & noexcept(curry<void>::is_nothrow_callable_v<callable_t&, decltype(values)..., args_t...>)
+	{
+		return std::invoke(function, values..., std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const&, decltype(values)..., args_t...>
+	constexpr decltype(auto) operator()(args_t&&...args) const& noexcept(curry<void>::is_nothrow_callable_v<callable_t const&, decltype(values)..., args_t...>)
+	{
+		return std::invoke(function, values..., std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t, decltype(values)..., args_t...>
+	constexpr decltype(auto) operator()(args_t&&...args) && noexcept(curry<void>::is_nothrow_callable_v<callable_t, decltype(values)..., args_t...>)
+	{
+		return std::invoke(std::move(function), values..., std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const, decltype(values)..., args_t...>
+	constexpr decltype(auto) operator()(args_t&&...args) const&& noexcept(curry<void>::is_nothrow_callable_v<callable_t const, decltype(values)..., args_t...>)
+	{
+		return std::invoke(std::move(function), values..., std::forward<args_t>(args)...);
+	}
+
+	//The callable the constants are bound to
+	constexpr callable_t const& callable() const& noexcept
+	{
+		return function;
+	}
+
+	constexpr callable_t&& callable() && noexcept
+	{
+		return std::move(function);
+	}
+
+	//Produces a constant_application with more_values bound after the ones already held, rather than wrapping *this in another layer
+	template<auto...more_values>
+	constexpr auto append() const& noexcept(std::is_nothrow_copy_constructible_v<callable_t>)
+	{
+		return constant_application<callable_t, values..., more_values...>{function};
+	}
+
+	template<auto...more_values>
+	constexpr auto append() && noexcept(std::is_nothrow_move_constructible_v<callable_t>)
+	{
+		return constant_application<callable_t, values..., more_values...>{std::move(function)};
+	}
+};
+
+//Arguments bound after the constants are stored however callable_t would store them
+template<typename callable_t, auto...values>
+struct curry<void>::bound_argument<constant_application<callable_t, values...>> : curry<void>::bound_argument<callable_t> {};
+
+//constant_application<callable_t, values...> takes sizeof...(values) fewer arguments than callable_t, so it gets the same single step splitting of arguments
+template<typename callable_t, auto...values>
+	requires requires { curry<void>::known_arity<callable_t>::value; } && (curry<void>::known_arity<callable_t>::value >= sizeof...(values))
+struct curry<void>::known_arity<constant_application<callable_t, values...>> :
+	curry<void>::arity_of<curry<void>::known_arity<callable_t>::value - sizeof...(values), curry<void>::known_arity<callable_t>::may_default> {};
+
+template<typename t>
+struct is_constant_application : std::false_type {};
+
+template<typename callable_t, auto...values>
+struct is_constant_application<constant_application<callable_t, values...>> : std::true_type {};
+
+template<auto...values, typename callable_t>
+constexpr auto bind_constants(callable_t&& f);
+
+//Like curry<void>::find_saturation_point, the number of values... from the front which an rvalue callable_t can be invoked with, or 0 if there is none
+template<typename callable_t, auto...values>
+constexpr std::size_t constant_saturation_point()
+{
+	return []<std::size_t...ks>(std::index_sequence<ks...>)
+	{
+		std::size_t point = 0;
+		((point = point == 0 && []<std::size_t...is>(std::index_sequence<is...>)
+			{
+				return std::is_invocable_v<callable_t, std::tuple_element_t<is, std::tuple<decltype(values)...>>...>;
+			}(std::make_index_sequence<ks + 1>{}) ? ks + 1 : point), ...);
+		return point;
+	}(std::make_index_sequence<sizeof...(values)>{});
+}
+
+//Wraps up a constant_application in a curry, splitting its constants where they saturate it, as curry{f}(values...) would
+//The ones up to that point are applied right away, and the rest are bound to the result
+//A result that can't be callable at all (such as an int) is rejected, rather than having the rest bound to it in a partial application that could never be invoked
+template<typename callable_t, auto...values>
+constexpr auto curry_constant_application(constant_application<callable_t, values...>&& application)
+{
+	constexpr std::size_t point = constant_saturation_point<callable_t, values...>();
+	if constexpr (point == 0)
+	{
+		return curry{std::move(application)};
+	}
+	else if constexpr (point == sizeof...(values))
+	{
+		return curry{std::move(application)}();
+	}
+	else
+	{
+		return [&]<std::size_t...is, std::size_t...js>(std::index_sequence<is...>, std::index_sequence<js...>)
+		{
+			constexpr std::tuple<decltype(values)...> all_values{values...};
+			using saturated_t = decltype(curry{constant_application<callable_t, std::get<is>(all_values)...>{std::move(application).callable()}}());
+			static_assert(!std::is_void_v<saturated_t>, "bind_constants: the first constants saturate f, which returns void, so the rest of them can't be applied to anything");
+			if constexpr (!std::is_void_v<saturated_t>)
+			{
+				using result_t = std::remove_cvref_t<decltype(uncurry(std::declval<saturated_t>()))>;
+				static_assert(std::is_class_v<result_t> || std::is_function_v<std::remove_pointer_t<result_t>> || std::is_member_pointer_v<result_t>,
+					"bind_constants: the first constants saturate f, and its result can't be callable with the rest of them");
+			}
+			return bind_constants<std::get<point + js>(all_values)...>(
+				curry{constant_application<callable_t, std::get<is>(all_values)...>{std::move(application).callable()}}());
+		}(std::make_index_sequence<point>{}, std::make_index_sequence<sizeof...(values) - point>{});
+	}
+}
+
+//Binds values... in front of the arguments of f, returning a curry, just like curry{f}(values...)
+//f may be a callable or a curry, in which case its wrapped callable is bound to (and constants already bound to it are appended to)
+//As with curry{f}(values...), if values... are all of the arguments of f, then f is invoked right away and its result is returned
+//If there are more of them than that, the rest are bound to that result in turn
+template<auto...values, typename callable_t>
+constexpr auto bind_constants(callable_t&& f)
+{
+	if constexpr (requires { typename uncurried<std::remove_cvref_t<callable_t>>::type; })
+	{
+		return bind_constants<values...>(uncurry(std::forward<callable_t>(f)));
+	}
+	else if constexpr (is_constant_application<std::remove_cvref_t<callable_t>>::value)
+	{
+		return curry_constant_application(std::forward<callable_t>(f).template append<values...>());
+	}
+	else
+	{
+		return curry_constant_application(constant_application<std::decay_t<callable_t>, values...>{std::forward<callable_t>(f)});
+	}
+}
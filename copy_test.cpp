@@ -0,0 +1,145 @@
+/*
+Checks the exact number of copies and moves that applying arguments to a curry costs, for every application pattern and value category
+Prints a line for each case and exits with a nonzero status if any count differs from what is expected, so it can be run as an automated test
+
+The expected counts are the least that the semantics allow:
+Arguments that saturate a call are forwarded straight to the callable, so they are only copied or moved if the callable takes them by value
+Arguments that are bound are copied (or moved, if they are rvalues) into the partial application once
+Binding more arguments to an rvalue partial application moves what it already holds into the new one, which has room for the new arguments too
+Binding more arguments to an lvalue partial application refers to it through a std::ref, so nothing it holds is copied
+*/
+
+#include<cstdio>
+#include<utility>
+#include"currying.h"
+
+
+//Counts its copies and moves in static counters, which each case resets
+struct counted
+{
+	static inline int copies = 0;
+	static inline int moves = 0;
+
+	int value;
+
+	counted(int value) : value(value) {}
+	counted(counted const& rhs) : value(rhs.value) { ++copies; }
+	counted(counted&& rhs) noexcept : value(rhs.value) { ++moves; }
+	counted& operator=(counted const& rhs) { value = rhs.value; ++copies; return *this; }
+	counted& operator=(counted&& rhs) noexcept { value = rhs.value; ++moves; return *this; }
+};
+
+//Like counted, but can't be copied
+struct move_only
+{
+	int value;
+
+	move_only(int value) : value(value) {}
+	move_only(move_only const&) = delete;
+	move_only(move_only&& rhs) noexcept : value(rhs.value) { ++counted::moves; }
+	move_only& operator=(move_only const&) = delete;
+	move_only& operator=(move_only&& rhs) noexcept { value = rhs.value; ++counted::moves; return *this; }
+};
+
+//A callable which counts its own copies and moves in the same counters, and isn't trivially copyable
+struct counted_callable
+{
+	counted_callable() = default;
+	counted_callable(counted_callable const&) { ++counted::copies; }
+	counted_callable(counted_callable&&) noexcept { ++counted::moves; }
+
+	int operator()(int a, int b, int c) const { return a + b + c; }
+};
+
+int by_reference(counted const& a, counted const& b, counted const& c)
+{
+	return a.value + b.value + c.value;
+}
+
+int by_value(counted a, counted b, counted c)
+{
+	return a.value + b.value + c.value;
+}
+
+int by_move(move_only a, move_only b)
+{
+	return a.value + b.value;
+}
+
+int failures = 0;
+
+//Runs f after resetting the counters, then compares the counters against the expected counts
+template<typename f_t>
+void check(char const* name, int expected_copies, int expected_moves, f_t&& f)
+{
+	counted::copies = 0;
+	counted::moves = 0;
+
+	f();
+
+	bool const is_ok = counted::copies == expected_copies && counted::moves == expected_moves;
+	failures += !is_ok;
+
+	std::printf("%s %-58s copies: %d (expected %d), moves: %d (expected %d)\n",
+		is_ok ? "ok    " : "FAILED", name, counted::copies, expected_copies, counted::moves, expected_moves);
+}
+
+int main()
+{
+	counted a{1};
+	counted b{2};
+	counted c{3};
+	counted const ca{1};
+
+	//Arguments which saturate the callable right away
+
+	check("curry{f}(a, b, c), f by reference", 0, 0, [&] { (void)int(curry{&by_reference}(a, b, c)); });
+	check("curry{f}(a, b, c), f by value", 3, 0, [&] { (void)int(curry{&by_value}(a, b, c)); });
+	check("curry{f}(move(a), move(b), move(c)), f by value", 0, 3, [&] { (void)int(curry{&by_value}(std::move(a), std::move(b), std::move(c))); });
+	check("curry{f, a, b, c}, f by reference", 0, 0, [&] { (void)int(curry{&by_reference, a, b, c}); });
+
+	//Arguments applied one at a time, to rvalue partial applications
+
+	check("curry{f}(a)(b)(c), f by reference", 2, 1, [&] { (void)int(curry{&by_reference}(a)(b)(c)); });
+	check("curry{f}(ca)(b)(c), f by reference", 2, 1, [&] { (void)int(curry{&by_reference}(ca)(b)(c)); });
+	check("curry{f}(move(a))(move(b))(c), f by reference", 0, 3, [&] { (void)int(curry{&by_reference}(std::move(a))(std::move(b))(c)); });
+	check("curry{f}(a)(b)(c), f by value", 3, 3, [&] { (void)int(curry{&by_value}(a)(b)(c)); });
+	check("curry{f}(a, b)(c), f by reference", 2, 0, [&] { (void)int(curry{&by_reference}(a, b)(c)); });
+	check("curry{f, a, b}(c), f by reference", 2, 0, [&] { (void)int(curry{&by_reference, a, b}(c)); });
+	check("curry{f, a}(b)(c), f by reference", 2, 1, [&] { (void)int(curry{&by_reference, a}(b)(c)); });
+
+	//Partial applications applied to through lvalues and rvalues
+
+	auto bound = curry{&by_reference}(a, b);
+	auto const const_bound = curry{&by_reference}(a, b);
+	auto bound_by_value = curry{&by_value}(a, b);
+
+	check("lvalue curry{f}(a, b) applied to c, f by reference", 0, 0, [&] { (void)int(bound(c)); });
+	check("const lvalue curry{f}(a, b) applied to c, f by reference", 0, 0, [&] { (void)int(const_bound(c)); });
+	check("lvalue curry{f}(a, b) applied to c, f by value", 3, 0, [&] { (void)int(bound_by_value(c)); });
+	check("rvalue curry{f}(a, b) applied to c, f by reference", 0, 0, [&] { (void)int(std::move(bound)(c)); });
+	check("rvalue curry{f}(a, b) applied to c, f by value", 1, 2, [&] { (void)int(std::move(bound_by_value)(c)); });
+
+	auto partial = curry{&by_reference}(a);
+
+	check("lvalue curry{f}(a) applied to (b)(c)", 1, 0, [&] { (void)int(partial(b)(c)); });
+	check("copy of curry{f}(a, b)", 2, 0, [&] { auto copy = const_bound; (void)copy; });
+
+	//Move-only arguments, which can only ever be moved
+
+	check("curry{f}(move_only)(move_only), f by value", 0, 3, [&] { (void)int(curry{&by_move}(move_only{1})(move_only{2})); });
+	check("curry{f, move_only}(move_only), f by value", 0, 3, [&] { (void)int(curry{&by_move, move_only{1}}(move_only{2})); });
+
+	//The callable itself, which is copied or moved along with the partial applications holding it
+
+	counted_callable callable;
+	curry<counted_callable> curried_callable{callable};
+
+	check("curry{callable}", 1, 0, [&] { curry copy{callable}; (void)copy; });
+	check("curry{move(callable)}", 0, 1, [&] { curry moved{std::move(callable)}; (void)moved; });
+	check("lvalue curry{callable}(1)(2)(3)", 0, 0, [&] { (void)int(curried_callable(1)(2)(3)); });
+	check("lvalue curry{callable}(1, 2, 3)", 0, 0, [&] { (void)int(curried_callable(1, 2, 3)); });
+	check("rvalue curry{callable}(1)(2)(3)", 0, 2, [&] { (void)int(std::move(curried_callable)(1)(2)(3)); });
+
+	return failures != 0;
+}
@@ -6,10 +6,13 @@ curried: a concept for instances of curried
 is_curried_v: The constexpr bool used to implement curried
 
 is_curried: A template struct with a static constexpr bool value corresponding to is_curried_v
+
+is_curried_signature: the check of a curry against a particular signature, which is done all at once when the arity of its callable is known
 */
 
 
 #pragma once
+#include<tuple>
 #include "curry.h"
 
 
@@ -79,9 +82,132 @@ constexpr bool is_curried_v<curry<t>, return_t, void, args_t...> = requires (cur
 	{a()} -> curried<return_t, args_t...>;
 };
 
-//Recursive case where first argment is a particular type (confusingly represented as the void type)
+//Rather an implementation detail of is_curried_v, which checks a curry<t> against a signature with at least one (non-unit) argument
+//When the arity of t can be read off of its type and is exactly the number of arguments, applying them one at a time can only ever
+//bind all but the last one and then saturate, so the signature is checked with a single invocability check, done the way that last application would invoke t
+//Otherwise (or in the few cases where that isn't exact), arguments are applied one at a time, instantiating a new curry type and its operator() at each step
+//Since this is a class template, the result for any one signature is only computed once, however many constraints check it
 template<typename t, typename return_t, typename arg1_t, typename...args_t>
-constexpr bool is_curried_v<curry<t>, return_t, arg1_t, args_t...> = requires (curry<t> a)
+struct is_curried_signature
 {
-	{a(std::declval<arg1_t>())} -> curried<return_t, args_t...>;
-};
\ No newline at end of file
+private:
+
+	//What curry<t>::operator() & applies the first argument to
+	using lvalue_callable_t = decltype(curry<void>::lvalue_callable(std::declval<t&>()));
+	using arity_t = curry<void>::known_arity<lvalue_callable_t>;
+	using args_tuple_t = std::tuple<arg1_t, args_t...>;
+
+	static constexpr std::size_t count = 1 + sizeof...(args_t);
+
+	//The k-th application (with k being one more than the size of the index sequence) invokes the callable the way this does
+	//The first one invokes the callable passed on by curry<t>::operator() & directly, with an rvalue
+	//Later ones go through std::refs of the partial applications before them, so the callable and bound arguments are lvalues
+	template<std::size_t...is>
+	static constexpr bool is_invocable_at(std::index_sequence<is...>)
+	{
+		if constexpr (sizeof...(is) == 0)
+		{
+			return std::is_invocable_v<lvalue_callable_t, arg1_t>;
+		}
+		else
+		{
+			return std::is_invocable_v<lvalue_callable_t&, std::tuple_element_t<is, args_tuple_t>&..., std::tuple_element_t<sizeof...(is), args_tuple_t>>;
+		}
+	}
+
+	template<std::size_t...is>
+	static auto invoke_last(std::index_sequence<is...>)
+	{
+		if constexpr (sizeof...(is) == 0)
+		{
+			return std::type_identity<std::invoke_result_t<lvalue_callable_t, arg1_t>>{};
+		}
+		else
+		{
+			return std::type_identity<std::invoke_result_t<lvalue_callable_t&, std::tuple_element_t<is, args_tuple_t>&..., std::tuple_element_t<count - 1, args_tuple_t>>>{};
+		}
+	}
+
+	template<std::size_t...ks>
+	static constexpr bool is_invocable_before_last(std::index_sequence<ks...>)
+	{
+		return (is_invocable_at(std::make_index_sequence<ks>{}) || ...);
+	}
+
+	template<typename arg_t>
+	static constexpr bool is_bound_as_is = std::is_object_v<arg_t> && !std::same_as<std::remove_cv_t<arg_t>, curry_placeholder> &&
+		std::same_as<curry<void>::bound_argument_t<lvalue_callable_t, arg_t>, arg_t>;
+
+	//Whether applying the arguments one at a time binds every one of them but the last, and binds them as they are, through std::refs as described above
+	//If the callable may have default arguments, none of the earlier applications can be allowed to saturate it
+	//If the first partial application is copied rather than referenced (which only happens when everything in it is empty), categories differ, so this is left to the general case
+	static constexpr bool is_bound_until_last()
+	{
+		if constexpr (requires { arity_t::value; })
+		{
+			if constexpr (arity_t::value == count && is_bound_as_is<arg1_t> && (is_bound_as_is<args_t> && ...))
+			{
+				if constexpr (count > 1 && curry<void>::copies_on_lvalue_application<curry<void>::partial_application<lvalue_callable_t, arg1_t>>)
+				{
+					return false;
+				}
+				else
+				{
+					return !arity_t::may_default || !is_invocable_before_last(std::make_index_sequence<count - 1>{});
+				}
+			}
+		}
+		return false;
+	}
+
+	//The general case, applying the first argument and checking the rest of the signature against the result
+	static constexpr bool is_curried_after_first()
+	{
+		return requires (curry<t> a)
+		{
+			{a(std::declval<arg1_t>())} -> curried<return_t, args_t...>;
+		};
+	}
+
+	//Every branch returns, so that the general case is only instantiated where the one step check can't decide
+	//(a return in an if constexpr branch doesn't discard what follows it, so falling through to it would instantiate the whole recursion anyway)
+	static constexpr bool check()
+	{
+		if constexpr (is_bound_until_last())
+		{
+			if constexpr (is_invocable_at(std::make_index_sequence<count - 1>{}))
+			{
+				using result_t = typename decltype(invoke_last(std::make_index_sequence<count - 1>{}))::type;
+				if constexpr (std::is_void_v<result_t>)
+				{
+					return std::is_void_v<return_t>;
+				}
+				else
+				{
+					return is_curried_v<curry<void>::wrapped_result_t<result_t>, return_t>;
+				}
+			}
+			//The last argument is bound as well, and a curry of a partial application only converts to class types which are constructible from it
+			else if constexpr (!std::is_class_v<std::remove_cvref_t<return_t>>)
+			{
+				return false;
+			}
+			else
+			{
+				return is_curried_after_first();
+			}
+		}
+		else
+		{
+			return is_curried_after_first();
+		}
+	}
+
+public:
+
+	static constexpr bool value = check();
+};
+
+//Recursive case where first argment is a particular type (confusingly represented as the void type)
+template<typename t, typename return_t, typename arg1_t, typename...args_t>
+constexpr bool is_curried_v<curry<t>, return_t, arg1_t, args_t...> = is_curried_signature<t, return_t, arg1_t, args_t...>::value;
\ No newline at end of file
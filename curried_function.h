@@ -0,0 +1,209 @@
+/*
+Overview of this file:
+
+curried_function<ret_t(args_t...), buffer_size, allows_allocation>: a type-erased callable stored in an inline buffer
+
+curried_function::curried_function: constructors from any callable invocable as ret_t(args_t...), including instances of curry
+
+curried_function::operator(): invokes the stored callable with a single indirect call
+
+curried_function copy/move constructors and assignment operators, which copy/move the stored callable into the new buffer
+*/
+
+
+#pragma once
+#include<cstddef>
+#include<memory>
+#include<new>
+#include<utility>
+#include "curry.h"
+
+
+template<typename signature_t, std::size_t buffer_size = 3 * sizeof(void*), bool allows_allocation = false>
+class curried_function;
+
+//Like std::function, but the callable is always stored in buffer_size bytes within the object itself
+//Callables that are too big (or too aligned, or not nothrow movable) fail to compile, unless allows_allocation is true
+//In that case they are stored on the heap instead, so nothing is allocated unless it is explicitly asked for
+//Meant to be wrapped up by curry, so curry<curried_function<ret_t(args_t...)>> is curried<ret_t, args_t...>
+//Instances of curry can be stored directly, so partial applications keep their types hidden behind the same signature
+//Just like std::function, the stored callable is invoked as a (non-const) lvalue
+//Calling an empty curried_function is undefined behavior
+template<typename ret_t, typename...args_t, std::size_t buffer_size, bool allows_allocation>
+class curried_function<ret_t(args_t...), buffer_size, allows_allocation>
+{
+private:
+
+	enum class operation { copy, move, destroy };
+
+	template<typename t>
+	static constexpr bool stored_inline = sizeof(t) <= buffer_size && alignof(t) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<t>;
+
+	//mutable because the stored callable is invoked as a non-const lvalue, even through operator() const
+	alignas(std::max_align_t) mutable std::byte buffer[buffer_size];
+	ret_t(*invoker)(void*, args_t&&...) = nullptr;
+	void(*manager)(operation, void*, void*) = nullptr;
+
+	template<typename t>
+	static t* target(void* storage)
+	{
+		if constexpr (stored_inline<t>)
+		{
+			return std::launder(static_cast<t*>(storage));
+		}
+		else
+		{
+			return *static_cast<t**>(storage);
+		}
+	}
+
+	template<typename t>
+	static ret_t invoke(void* storage, args_t&&...args)
+	{
+		if constexpr (std::is_void_v<ret_t>)
+		{
+			std::invoke(*target<t>(storage), std::forward<args_t>(args)...);
+		}
+		else
+		{
+			return std::invoke(*target<t>(storage), std::forward<args_t>(args)...);
+		}
+	}
+
+	//Copies or moves the callable stored in source into the (empty) destination, or destroys the callable in destination
+	template<typename t>
+	static void manage(operation op, void* destination, void* source)
+	{
+		switch(op)
+		{
+		case operation::copy:
+			if constexpr (stored_inline<t>)
+			{
+				::new(destination) t(*target<t>(source));
+			}
+			else
+			{
+				*static_cast<t**>(destination) = new t(*target<t>(source));
+			}
+			break;
+		case operation::move:
+			if constexpr (stored_inline<t>)
+			{
+				::new(destination) t(std::move(*target<t>(source)));
+				std::destroy_at(target<t>(source));
+			}
+			else
+			{
+				*static_cast<t**>(destination) = target<t>(source);
+			}
+			break;
+		case operation::destroy:
+			if constexpr (stored_inline<t>)
+			{
+				std::destroy_at(target<t>(destination));
+			}
+			else
+			{
+				delete target<t>(destination);
+			}
+			break;
+		}
+	}
+
+	void take(curried_function&& rhs) noexcept
+	{
+		if(rhs.manager)
+		{
+			rhs.manager(operation::move, buffer, rhs.buffer);
+		}
+		invoker = std::exchange(rhs.invoker, nullptr);
+		manager = std::exchange(rhs.manager, nullptr);
+	}
+
+	void reset() noexcept
+	{
+		if(manager)
+		{
+			manager(operation::destroy, buffer, nullptr);
+		}
+		invoker = nullptr;
+		manager = nullptr;
+	}
+
+public:
+
+	curried_function() = default;
+
+	template<typename callable_t>
+		requires (!std::same_as<std::remove_cvref_t<callable_t>, curried_function>) && std::is_invocable_r_v<ret_t, std::decay_t<callable_t>&, args_t...>
+	curried_function(callable_t&& callable)
+	{
+		using stored_t = std::decay_t<callable_t>;
+
+		static_assert(stored_inline<stored_t> || allows_allocation,
+			"callable does not fit in the buffer of this curried_function, increase buffer_size or set allows_allocation");
+		static_assert(stored_inline<stored_t> || buffer_size >= sizeof(stored_t*),
+			"buffer_size must be able to hold a pointer for heap allocated callables");
+
+		if constexpr (stored_inline<stored_t>)
+		{
+			::new(static_cast<void*>(buffer)) stored_t(std::forward<callable_t>(callable));
+		}
+		else
+		{
+			*reinterpret_cast<stored_t**>(buffer) = new stored_t(std::forward<callable_t>(callable));
+		}
+
+		invoker = &invoke<stored_t>;
+		manager = &manage<stored_t>;
+	}
+
+	curried_function(curried_function const& rhs) : invoker(rhs.invoker), manager(rhs.manager)
+	{
+		if(manager)
+		{
+			manager(operation::copy, buffer, rhs.buffer);
+		}
+	}
+
+	curried_function(curried_function&& rhs) noexcept
+	{
+		take(std::move(rhs));
+	}
+
+	curried_function& operator=(curried_function const& rhs)
+	{
+		if(this != &rhs)
+		{
+			curried_function copy(rhs);
+			reset();
+			take(std::move(copy));
+		}
+		return *this;
+	}
+
+	curried_function& operator=(curried_function&& rhs) noexcept
+	{
+		if(this != &rhs)
+		{
+			reset();
+			take(std::move(rhs));
+		}
+		return *this;
+	}
+
+	~curried_function()
+	{
+		reset();
+	}
+
+	explicit operator bool() const noexcept
+	{
+		return invoker != nullptr;
+	}
+
+	ret_t operator()(args_t...args) const
+	{
+		return invoker(buffer, std::forward<args_t>(args)...);
+	}
+};
@@ -15,15 +15,40 @@ curry<t>::operator(): partially apply any number of arguments to and possibly ev
 curry<t> implicit conversions to references to the wrapped type
 
 curry<t> default/copy/move constructors, copy/move assignment operators, destructor, all created via = default
+
+curry<void>::partial_application: the flat representation of a callable with some of its arguments bound
+
+curry<void>::bound_argument: the customization point deciding how arguments bound to a particular callable are stored
+
+curry_placeholder: the type of curry_placeholders::_, which can be passed to curry<t>::operator() to leave an argument unbound, as in f(_, y)
 */
 
 #pragma once
+#include<array>
 #include<concepts>
 #include<functional>
 
+//MSVC ignores the standard spelling of the attribute (for ABI compatibility) but honors its own
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CURRY_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define CURRY_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 template<typename callable_t>
 class curry;
 
+//Passing a placeholder to a curry leaves that argument unbound, so that the arguments after it can be bound first
+//The arguments applied later fill the placeholders in order before any further arguments are bound, so curry{f}(_, y)(x) is f(x, y)
+//Arguments are never invoked with placeholders, so a callable is only saturated by the arguments before the first placeholder
+struct curry_placeholder {};
+
+//Kept in a namespace of its own, like std::placeholders, so that it can be brought in with using curry_placeholders::_;
+namespace curry_placeholders
+{
+	inline constexpr curry_placeholder _{};
+}
+
 //Invalid instance of curry, should not occur unless a void results from a curry constructor with multiple arguments
 //For this reason, it is used to store some static methods without cluttering the global namespace
 //Rather an implementation detail, contents are not meant to be used, though they also dont leak the implementation
@@ -48,8 +73,463 @@ public:
 	constexpr ~curry() = default;
 	
 
+	//std::is_nothrow_invocable_v, but looking through std::reference_wrapper, whose operator() isn't noexcept in every standard library
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr bool is_nothrow_callable_v = std::is_nothrow_invocable_v<
+		std::conditional_t<std::is_same_v<std::unwrap_reference_t<std::remove_cvref_t<forwarding_callable_t>>, std::remove_cvref_t<forwarding_callable_t>>,
+			forwarding_callable_t, std::unwrap_reference_t<std::remove_cvref_t<forwarding_callable_t>>>, args_t...>;
+
+	//The index of the element of ts that packed_storage<ts...> lays out at the given position
+	//Elements are ordered by decreasing alignment (and otherwise kept in order), so that no padding is needed between them
+	template<typename...ts>
+	static constexpr std::size_t laid_out_at(std::size_t position)
+	{
+		constexpr std::size_t alignments[] = {alignof(ts)...};
+
+		for(std::size_t i = 0; i != sizeof...(ts); ++i)
+		{
+			std::size_t rank = 0;
+			for(std::size_t j = 0; j != sizeof...(ts); ++j)
+			{
+				rank += alignments[j] > alignments[i] || (alignments[j] == alignments[i] && j < i);
+			}
+			if(rank == position)
+			{
+				return i;
+			}
+		}
+		return 0;
+	}
+
+	template<std::size_t i, typename t>
+	//Constructed through a constructor rather than as an aggregate, since gcc zeroes the bytes of an empty [[no_unique_address]] member
+	//initialized as part of an aggregate, overwriting whichever other value shares its address
+	struct storage_slot
+	{
+		CURRY_NO_UNIQUE_ADDRESS t value;
+
+		template<typename c_t>
+		constexpr storage_slot(std::in_place_t, c_t&& c) noexcept(std::is_nothrow_constructible_v<t, c_t>) : value(std::forward<c_t>(c)) {}
+	};
+
+	//Tag for the constructor of curry<t> which initializes the wrapped t directly from the result of invoking a callable
+	//Since that result is a prvalue of type t, copy elision is guaranteed, so t doesn't even need to be movable
+	struct invoke_in_place_t {};
+
+	//Holds the value wrapped by a curry<t>, which is initialized either from a t or from the result of an invocation
+	//Prvalues aren't guaranteed to be elided into [[no_unique_address]] members, since those may overlap other objects
+	//So the value is a plain member, unless it is empty, in which case it has to be [[no_unique_address]] for curry<t> to be empty as well
+	template<typename t, bool = std::is_empty_v<t>>
+	struct wrapped_value
+	{
+		t value;
+
+		wrapped_value() = default;
+
+		template<typename c_t>
+		constexpr wrapped_value(std::in_place_t, c_t&& c) noexcept(std::is_nothrow_constructible_v<t, c_t>) : value(std::forward<c_t>(c)) {}
+
+		template<typename c_callable_t, typename...args_t>
+		constexpr wrapped_value(invoke_in_place_t, c_callable_t&& callable, args_t&&...args) noexcept(is_nothrow_callable_v<c_callable_t, args_t...>) :
+			value(std::invoke(std::forward<c_callable_t>(callable), std::forward<args_t>(args)...)) {}
+	};
+
+	template<typename t>
+	struct wrapped_value<t, true>
+	{
+		CURRY_NO_UNIQUE_ADDRESS t value;
+
+		wrapped_value() = default;
+
+		template<typename c_t>
+		constexpr wrapped_value(std::in_place_t, c_t&& c) noexcept(std::is_nothrow_constructible_v<t, c_t>) : value(std::forward<c_t>(c)) {}
+
+		template<typename c_callable_t, typename...args_t>
+		constexpr wrapped_value(invoke_in_place_t, c_callable_t&& callable, args_t&&...args) noexcept(is_nothrow_callable_v<c_callable_t, args_t...>) :
+			value(std::invoke(std::forward<c_callable_t>(callable), std::forward<args_t>(args)...)) {}
+	};
+
+	//Placeholders don't hold anything, so they aren't stored, and take up no space even when there are several of them
+	template<std::size_t i>
+	struct storage_slot<i, curry_placeholder>
+	{
+		static constexpr curry_placeholder value{};
+
+		constexpr storage_slot(std::in_place_t, curry_placeholder) noexcept {}
+	};
+
+	//Stores one value of each of ts, accessed by index as with a std::tuple
+	//Unlike a std::tuple, the layout is guaranteed: values are laid out in decreasing order of alignment, so padding is minimal
+	//Every value is also [[no_unique_address]], so values of distinct empty types take up no space
+	template<typename positions_t, typename...ts>
+	class packed_storage;
+
+	template<std::size_t...positions, typename...ts>
+	class packed_storage<std::index_sequence<positions...>, ts...> :
+		storage_slot<laid_out_at<ts...>(positions), std::tuple_element_t<laid_out_at<ts...>(positions), std::tuple<ts...>>>...
+	{
+	private:
+
+		template<std::size_t i>
+		using slot_t = storage_slot<i, std::tuple_element_t<i, std::tuple<ts...>>>;
+
+		template<typename refs_t>
+		constexpr packed_storage(refs_t&& refs, std::in_place_t)
+			noexcept((std::is_nothrow_constructible_v<ts, std::tuple_element_t<laid_out_at<ts...>(positions), refs_t>> && ...)) :
+			slot_t<laid_out_at<ts...>(positions)>(std::in_place, std::get<laid_out_at<ts...>(positions)>(std::move(refs)))... {}
+
+	public:
+
+		template<typename...c_ts>
+		constexpr packed_storage(std::in_place_t, c_ts&&...values) noexcept((std::is_nothrow_constructible_v<ts, c_ts> && ...)) :
+			packed_storage(std::forward_as_tuple(std::forward<c_ts>(values)...), std::in_place) {}
+
+		template<std::size_t i>
+		constexpr auto& get() & noexcept
+		{
+			return static_cast<slot_t<i>&>(*this).value;
+		}
+
+		template<std::size_t i>
+		constexpr auto const& get() const& noexcept
+		{
+			return static_cast<slot_t<i> const&>(*this).value;
+		}
+
+		template<std::size_t i>
+		constexpr auto&& get() && noexcept
+		{
+			return std::move(static_cast<slot_t<i>&>(*this).value);
+		}
+
+		template<std::size_t i>
+		constexpr auto const&& get() const&& noexcept
+		{
+			return std::move(static_cast<slot_t<i> const&>(*this).value);
+		}
+	};
+
+	//bound_argument<callable_t>::type<arg_t> is the type an argument of type arg_t is stored as when it is bound to a callable_t
+	//As with std::bind_front, this is std::decay_t<arg_t>, but it may be specialized for a callable to store some arguments differently
+	//Partial applications of, and reference wrappers to, a callable use the same bound_argument as the callable itself
+	template<typename callable_t>
+	struct bound_argument
+	{
+		template<typename arg_t>
+		using type = std::decay_t<arg_t>;
+	};
+
+	template<typename t>
+	struct bound_argument<std::reference_wrapper<t>> : bound_argument<std::remove_cv_t<t>> {};
+
+	//Placeholders are always bound as they are, whatever the callable, so that they can be filled in later
+	template<typename callable_t, typename arg_t>
+	using bound_argument_t = std::conditional_t<std::is_same_v<std::remove_cvref_t<arg_t>, curry_placeholder>,
+		curry_placeholder, typename bound_argument<std::remove_cvref_t<callable_t>>::template type<arg_t>>;
+
+	//partial_application_hook<callable_t>::created() is called whenever a new partial application of callable_t is constructed (but not copied or moved)
+	//It does nothing, but may be specialized for a callable to observe its partial applications, such as to count them
+	//Partial applications bound to a reference to (or a copy of) another partial application count as partial applications of the same callable
+	template<typename callable_t>
+	struct partial_application_hook
+	{
+		static constexpr void created() noexcept {}
+	};
+
+	template<typename t>
+	struct partial_application_hook<std::reference_wrapper<t>> : partial_application_hook<std::remove_cv_t<t>> {};
+
+	template<typename...ts>
+	static constexpr std::size_t placeholder_count = (std::size_t{std::is_same_v<std::remove_cvref_t<ts>, curry_placeholder>} + ... + 0);
+
+	//The index of the first placeholder among ts, or sizeof...(ts) if there is none
+	template<typename...ts>
+	static constexpr std::size_t first_placeholder()
+	{
+		constexpr bool is_placeholder[] = {std::is_same_v<std::remove_cvref_t<ts>, curry_placeholder>..., true};
+
+		std::size_t i = 0;
+		while(!is_placeholder[i])
+		{
+			++i;
+		}
+		return i;
+	}
+
+	//Where each argument passed on by a partial application with bound_ts comes from, when it is given arg_count more arguments
+	//Placeholders among bound_ts are filled by the new arguments in order, and any new arguments left over after that follow the bound ones
+	//Indices are those of a std::tuple<bound_ts..., args_t...>, so the ones from sizeof...(bound_ts) on refer to the new arguments
+	template<std::size_t arg_count, typename...bound_ts>
+	static constexpr auto merged_sources()
+	{
+		constexpr std::size_t bound_count = sizeof...(bound_ts);
+		constexpr std::size_t filled = arg_count < placeholder_count<bound_ts...> ? arg_count : placeholder_count<bound_ts...>;
+		constexpr bool is_placeholder[] = {std::is_same_v<bound_ts, curry_placeholder>..., false};
+
+		std::array<std::size_t, bound_count + arg_count - filled> sources{};
+		std::size_t next_arg = 0;
+		for(std::size_t i = 0; i != bound_count; ++i)
+		{
+			sources[i] = is_placeholder[i] && next_arg != arg_count ? bound_count + next_arg++ : i;
+		}
+		for(std::size_t i = bound_count; i != sources.size(); ++i)
+		{
+			sources[i] = bound_count + next_arg++;
+		}
+		return sources;
+	}
+
+	//A callable along with every argument that has been bound to it so far, held together in one flat packed_storage
+	//Invoking it behaves exactly like invoking the result of std::bind_front(callable, bound...)
+	//Binding more arguments to it appends them to the storage rather than wrapping it in another layer
+	//If some of the bound arguments are placeholders, new arguments fill those first, following merged_sources
+	//The order of the arguments is worked out at compile time, so the callable is still invoked directly with every argument
+	//Its size is that of a struct with the callable and bound arguments as members, sorted by decreasing alignment
+	//So if they are all of distinct empty types (such as stateless lambdas and tags), the partial application is empty too
+	template<typename callable_t, typename...bound_ts>
+	class partial_application
+	{
+	private:
+
+		//The callable is at index 0, followed by the bound arguments
+		CURRY_NO_UNIQUE_ADDRESS packed_storage<std::index_sequence_for<callable_t, bound_ts...>, callable_t, bound_ts...> storage;
+
+		template<typename self_t, std::size_t...is, typename...args_t>
+		static constexpr decltype(auto) invoke_bound(self_t&& self, std::index_sequence<is...>, args_t&&...args)
+		{
+			return std::invoke(std::forward<self_t>(self).storage.template get<0>(),
+				std::forward<self_t>(self).storage.template get<is + 1>()..., std::forward<args_t>(args)...);
+		}
+
+		template<typename self_t, std::size_t...is, typename...args_t>
+		static constexpr auto append_bound(self_t&& self, std::index_sequence<is...>, args_t&&...args)
+		{
+			return partial_application<callable_t, bound_ts..., bound_argument_t<callable_t, args_t>...>{std::in_place, std::forward<self_t>(self).storage.template get<0>(),
+				std::forward<self_t>(self).storage.template get<is + 1>()..., std::forward<args_t>(args)...};
+		}
+
+		static constexpr std::size_t placeholders = placeholder_count<bound_ts...>;
+
+		template<std::size_t arg_count, std::size_t...is>
+		static constexpr auto merged_sequence(std::index_sequence<is...>)
+		{
+			constexpr auto sources = merged_sources<arg_count, bound_ts...>();
+			return std::index_sequence<sources[is]...>{};
+		}
+
+		//The indices of merged_sources<arg_count, bound_ts...>() as a std::index_sequence
+		template<std::size_t arg_count>
+		using merged_sequence_t = decltype(merged_sequence<arg_count>(
+			std::make_index_sequence<sizeof...(bound_ts) + arg_count - (arg_count < placeholders ? arg_count : placeholders)>{}));
+
+		//Whether invoking a q_callable_t with the elements of all_args_t at the given indices is well formed, or is noexcept if is_nothrow
+		template<bool is_nothrow, typename q_callable_t, typename all_args_t, std::size_t...is>
+		static constexpr bool is_callable_with(std::index_sequence<is...>)
+		{
+			if constexpr (is_nothrow)
+			{
+				return is_nothrow_callable_v<q_callable_t, std::tuple_element_t<is, all_args_t>...>;
+			}
+			else
+			{
+				return std::is_invocable_v<q_callable_t, std::tuple_element_t<is, all_args_t>...>;
+			}
+		}
+
+		//The argument at the given index of a std::tuple<bound_ts..., args_t...>, where arg_refs holds references to the args
+		template<std::size_t source, typename self_t, typename arg_refs_t>
+		static constexpr decltype(auto) merged_argument(self_t&& self, arg_refs_t& arg_refs) noexcept
+		{
+			if constexpr (source < sizeof...(bound_ts))
+			{
+				return std::forward<self_t>(self).storage.template get<source + 1>();
+			}
+			else
+			{
+				return std::get<source - sizeof...(bound_ts)>(std::move(arg_refs));
+			}
+		}
+
+		template<typename self_t, std::size_t...is, typename...args_t>
+		static constexpr decltype(auto) invoke_merged(self_t&& self, std::index_sequence<is...>, args_t&&...args)
+		{
+			auto arg_refs = std::forward_as_tuple(std::forward<args_t>(args)...);
+			return std::invoke(std::forward<self_t>(self).storage.template get<0>(), merged_argument<is>(std::forward<self_t>(self), arg_refs)...);
+		}
+
+		template<typename self_t, std::size_t...is, typename...args_t>
+		static constexpr auto append_merged(self_t&& self, std::index_sequence<is...>, args_t&&...args)
+		{
+			using all_bound_t = std::tuple<bound_ts..., bound_argument_t<callable_t, args_t>...>;
+
+			auto arg_refs = std::forward_as_tuple(std::forward<args_t>(args)...);
+			return partial_application<callable_t, std::tuple_element_t<is, all_bound_t>...>{std::in_place, std::forward<self_t>(self).storage.template get<0>(),
+				merged_argument<is>(std::forward<self_t>(self), arg_refs)...};
+		}
+
+		template<typename self_t, typename...args_t>
+		static constexpr decltype(auto) invoke(self_t&& self, args_t&&...args)
+		{
+			if constexpr (placeholders == 0)
+			{
+				return invoke_bound(std::forward<self_t>(self), std::index_sequence_for<bound_ts...>{}, std::forward<args_t>(args)...);
+			}
+			else
+			{
+				return invoke_merged(std::forward<self_t>(self), merged_sequence_t<sizeof...(args_t)>{}, std::forward<args_t>(args)...);
+			}
+		}
+
+		template<typename self_t, typename...args_t>
+		static constexpr auto append_to(self_t&& self, args_t&&...args)
+		{
+			if constexpr (placeholders == 0)
+			{
+				return append_bound(std::forward<self_t>(self), std::index_sequence_for<bound_ts...>{}, std::forward<args_t>(args)...);
+			}
+			else
+			{
+				return append_merged(std::forward<self_t>(self), merged_sequence_t<sizeof...(args_t)>{}, std::forward<args_t>(args)...);
+			}
+		}
+
+	public:
+
+		template<typename c_callable_t, typename...c_bound_ts>
+		constexpr partial_application(std::in_place_t, c_callable_t&& c, c_bound_ts&&...b)
+			noexcept(std::is_nothrow_constructible_v<callable_t, c_callable_t> && (std::is_nothrow_constructible_v<bound_ts, c_bound_ts> && ...)) :
+			storage(std::in_place, std::forward<c_callable_t>(c), std::forward<c_bound_ts>(b)...)
+		{
+			partial_application_hook<callable_t>::created();
+		}
+
+		template<typename...args_t>
+			requires (placeholders == 0 && std::is_invocable_v<callable_t&, bound_ts&..., args_t...>) ||
+				(placeholders != 0 && sizeof...(args_t) >= placeholders && is_callable_with<false, callable_t&, std::tuple<bound_ts&..., args_t...>>(merged_sequence_t<sizeof...(args_t)>{}))
+		constexpr decltype(auto) operator()(args_t&&...args) & noexcept(is_callable_with<true, callable_t&, std::tuple<bound_ts&..., args_t...>>(merged_sequence_t<sizeof...(args_t)>{}))
+		{
+			return invoke(*this, std::forward<args_t>(args)...);
+		}
+
+		template<typename...args_t>
+			requires (placeholders == 0 && std::is_invocable_v<callable_t const&, bound_ts const&..., args_t...>) ||
+				(placeholders != 0 && sizeof...(args_t) >= placeholders && is_callable_with<false, callable_t const&, std::tuple<bound_ts const&..., args_t...>>(merged_sequence_t<sizeof...(args_t)>{}))
+		constexpr decltype(auto) operator()(args_t&&...args) const& noexcept(is_callable_with<true, callable_t const&, std::tuple<bound_ts const&..., args_t...>>(merged_sequence_t<sizeof...(args_t)>{}))
+		{
+			return invoke(*this, std::forward<args_t>(args)...);
+		}
+
+		template<typename...args_t>
+			requires (placeholders == 0 && std::is_invocable_v<callable_t, bound_ts..., args_t...>) ||
+				(placeholders != 0 && sizeof...(args_t) >= placeholders && is_callable_with<false, callable_t, std::tuple<bound_ts..., args_t...>>(merged_sequence_t<sizeof...(args_t)>{}))
+		constexpr decltype(auto) operator()(args_t&&...args) && noexcept(is_callable_with<true, callable_t, std::tuple<bound_ts..., args_t...>>(merged_sequence_t<sizeof...(args_t)>{}))
+		{
+			return invoke(std::move(*this), std::forward<args_t>(args)...);
+		}
+
+		template<typename...args_t>
+			requires (placeholders == 0 && std::is_invocable_v<callable_t const, bound_ts const..., args_t...>) ||
+				(placeholders != 0 && sizeof...(args_t) >= placeholders && is_callable_with<false, callable_t const, std::tuple<bound_ts const..., args_t...>>(merged_sequence_t<sizeof...(args_t)>{}))
+		constexpr decltype(auto) operator()(args_t&&...args) const&& noexcept(is_callable_with<true, callable_t const, std::tuple<bound_ts const..., args_t...>>(merged_sequence_t<sizeof...(args_t)>{}))
+		{
+			return invoke(std::move(*this), std::forward<args_t>(args)...);
+		}
+
+		//Produces a partial application with args bound after the ones already held (or in place of placeholders), copying or moving from *this
+		template<typename...args_t>
+			requires std::is_copy_constructible_v<callable_t> && (std::is_copy_constructible_v<bound_ts> && ...) &&
+				(std::is_constructible_v<bound_argument_t<callable_t, args_t>, args_t> && ...)
+		constexpr auto append(args_t&&...args) const&
+			noexcept(std::is_nothrow_copy_constructible_v<callable_t> && (std::is_nothrow_copy_constructible_v<bound_ts> && ...) &&
+				(std::is_nothrow_constructible_v<bound_argument_t<callable_t, args_t>, args_t> && ...))
+		{
+			return append_to(*this, std::forward<args_t>(args)...);
+		}
+
+		template<typename...args_t>
+			requires std::is_move_constructible_v<callable_t> && (std::is_move_constructible_v<bound_ts> && ...) &&
+				(std::is_constructible_v<bound_argument_t<callable_t, args_t>, args_t> && ...)
+		constexpr auto append(args_t&&...args) &&
+			noexcept(std::is_nothrow_move_constructible_v<callable_t> && (std::is_nothrow_move_constructible_v<bound_ts> && ...) &&
+				(std::is_nothrow_constructible_v<bound_argument_t<callable_t, args_t>, args_t> && ...))
+		{
+			return append_to(std::move(*this), std::forward<args_t>(args)...);
+		}
+	};
+
+	template<typename t>
+	struct is_partial_application : std::false_type {};
+
+	template<typename callable_t, typename...bound_ts>
+	struct is_partial_application<partial_application<callable_t, bound_ts...>> : std::true_type {};
+
+	template<typename callable_t, typename...bound_ts>
+	struct bound_argument<partial_application<callable_t, bound_ts...>> : bound_argument<callable_t> {};
+
+	template<typename callable_t, typename...bound_ts>
+	struct partial_application_hook<partial_application<callable_t, bound_ts...>> : partial_application_hook<callable_t> {};
+
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr bool is_nothrow_partially_applicable()
+	{
+		if constexpr (is_partial_application<std::remove_cvref_t<forwarding_callable_t>>::value)
+		{
+			return noexcept(std::declval<forwarding_callable_t>().append(std::declval<args_t>()...));
+		}
+		else
+		{
+			return std::is_nothrow_constructible_v<std::decay_t<forwarding_callable_t>, forwarding_callable_t> &&
+				(std::is_nothrow_constructible_v<bound_argument_t<forwarding_callable_t, args_t>, args_t> && ...);
+		}
+	}
+
+	//Whether partially_apply<forwarding_callable_t, args_t...> is well formed, which it isn't if the callable, any argument, or anything already bound can't be copied or moved into place
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr bool is_partially_applicable()
+	{
+		if constexpr (is_partial_application<std::remove_cvref_t<forwarding_callable_t>>::value)
+		{
+			return requires { std::declval<forwarding_callable_t>().append(std::declval<args_t>()...); };
+		}
+		else
+		{
+			return std::is_constructible_v<std::decay_t<forwarding_callable_t>, forwarding_callable_t> &&
+				(std::is_constructible_v<bound_argument_t<forwarding_callable_t, args_t>, args_t> && ...);
+		}
+	}
+
+	//Equivalent to std::bind_front, except that binding to a partial_application (not a reference to one) flattens into it
+	//Arguments are stored as their bound_argument_t, which is their decayed type unless the callable specializes bound_argument
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr auto partially_apply(forwarding_callable_t&& callable, args_t&&...args)
+		noexcept(is_nothrow_partially_applicable<forwarding_callable_t, args_t...>())
+	{
+		if constexpr (is_partial_application<std::remove_cvref_t<forwarding_callable_t>>::value)
+		{
+			return std::forward<forwarding_callable_t>(callable).append(std::forward<args_t>(args)...);
+		}
+		else
+		{
+			return partial_application<std::decay_t<forwarding_callable_t>, bound_argument_t<forwarding_callable_t, args_t>...>{std::in_place,
+				std::forward<forwarding_callable_t>(callable), std::forward<args_t>(args)...};
+		}
+	}
+
+	//partially_apply, but constructing the partial application directly inside of the curry returned, so that it isn't moved into it afterwards
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr auto partially_apply_curried(forwarding_callable_t&& callable, args_t&&...args)
+		noexcept(is_nothrow_partially_applicable<forwarding_callable_t, args_t...>())
+	{
+		return ::curry<decltype(partially_apply(std::declval<forwarding_callable_t>(), std::declval<args_t>()...))>{invoke_in_place_t{},
+			[&]() noexcept(is_nothrow_partially_applicable<forwarding_callable_t, args_t...>())
+			{
+				return partially_apply(std::forward<forwarding_callable_t>(callable), std::forward<args_t>(args)...);
+			}};
+	}
+
 	template<typename ret_t>
 	static constexpr auto handle_invoke_result(ret_t&& ret)
+		noexcept(std::is_lvalue_reference_v<ret_t> || (std::is_nothrow_constructible_v<std::decay_t<ret_t>, ret_t> && std::is_nothrow_move_constructible_v<std::decay_t<ret_t>>))
 	{
 		if constexpr(std::is_lvalue_reference_v<ret_t>)
 		{
@@ -61,15 +541,56 @@ public:
 		}
 	}
 
+	//The curry that a result of type ret_t is wrapped up in, which is what handle_invoke_result returns
+	//Lvalue references are wrapped as std::reference_wrapper, and results that are already a curry are left as they are
+	template<typename ret_t>
+	struct wrapped_result
+	{
+		using type = ::curry<ret_t>;
+	};
+
+	template<typename t>
+	struct wrapped_result<::curry<t>>
+	{
+		using type = ::curry<t>;
+	};
+
+	template<typename ret_t>
+	using wrapped_result_t = std::conditional_t<std::is_lvalue_reference_v<ret_t>,
+		::curry<std::reference_wrapper<std::remove_reference_t<ret_t>>>, typename wrapped_result<std::remove_cvref_t<ret_t>>::type>;
+
+	//Whether a result of type ret_t is constructed directly inside of the curry wrapping it up, rather than being passed to handle_invoke_result
+	//This is the case for prvalues, except for those that are already a curry, which are returned directly instead
+	template<typename ret_t>
+	static constexpr bool is_wrapped_in_place = !std::is_reference_v<ret_t> && !std::is_same_v<std::remove_cv_t<ret_t>, wrapped_result_t<ret_t>>;
+
+	//Whether saturate<forwarding_callable_t, args_t...> is noexcept, including the wrapping up of its result
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr bool is_nothrow_saturating()
+	{
+		using ret_t = std::invoke_result_t<forwarding_callable_t, args_t...>;
+
+		if constexpr (std::is_void_v<ret_t> || is_wrapped_in_place<ret_t> || std::is_same_v<ret_t, wrapped_result_t<ret_t>>)
+		{
+			return is_nothrow_callable_v<forwarding_callable_t, args_t...>;
+		}
+		else
+		{
+			return is_nothrow_callable_v<forwarding_callable_t, args_t...> && noexcept(handle_invoke_result(std::declval<ret_t>()));
+		}
+	}
+
 	template<typename forwarding_callable_t, typename arg1_t>
 	static constexpr auto do_apply(forwarding_callable_t&& callable, arg1_t&& arg1)
+		noexcept(is_nothrow_saturating<forwarding_callable_t, arg1_t>())
 		requires (std::is_invocable_v<forwarding_callable_t,arg1_t> && !std::is_void_v<std::invoke_result_t<forwarding_callable_t,arg1_t>>)
 	{
-		return handle_invoke_result(std::invoke(std::forward<forwarding_callable_t>(callable),std::forward<arg1_t>(arg1)));
+		return saturate(std::forward<forwarding_callable_t>(callable),std::forward<arg1_t>(arg1));
 	}
 
 	template<typename forwarding_callable_t, typename arg1_t>
 	static constexpr void do_apply(forwarding_callable_t&& callable, arg1_t&& arg1)
+		noexcept(is_nothrow_callable_v<forwarding_callable_t,arg1_t>)
 		requires (std::is_void_v<std::invoke_result_t<forwarding_callable_t,arg1_t>>)
 	{
 		return std::invoke(std::forward<forwarding_callable_t>(callable),std::forward<arg1_t>(arg1));
@@ -77,19 +598,315 @@ public:
 
 	template<typename forwarding_callable_t, typename arg1_t>
 	static constexpr auto do_apply(forwarding_callable_t&& callable, arg1_t&& arg1)
-		requires (!std::is_invocable_v<forwarding_callable_t,arg1_t>)
+		noexcept(is_nothrow_partially_applicable<forwarding_callable_t, arg1_t>())
+		requires (!std::is_invocable_v<forwarding_callable_t,arg1_t> && is_partially_applicable<forwarding_callable_t, arg1_t>())
 	{
-		return ::curry{std::bind_front(std::forward<forwarding_callable_t>(callable),std::forward<arg1_t>(arg1))};
+		return partially_apply_curried(std::forward<forwarding_callable_t>(callable),std::forward<arg1_t>(arg1));
 	}
 	
+	//The number of arguments taken by a callable whose signature can be read off of its type
+	//This covers function pointers, member pointers and classes with a single non-template operator()
+	//Generic or overloaded callables have no known arity (no nested value) and so have to be probed one argument at a time
+	//may_default is whether trailing parameters might have default arguments, which is only possible for operator()
+	template<typename t>
+	struct known_arity {};
+
+	template<std::size_t arity, bool may_default_v>
+	struct arity_of
+	{
+		static constexpr std::size_t value = arity;
+		static constexpr bool may_default = may_default_v;
+	};
+
+	template<typename ret_t, typename...params_t>
+	struct known_arity<ret_t(params_t...)> : arity_of<sizeof...(params_t), false> {};
+	template<typename ret_t, typename...params_t>
+	struct known_arity<ret_t(params_t...) noexcept> : arity_of<sizeof...(params_t), false> {};
+	template<typename function_t>
+	struct known_arity<function_t*> : known_arity<function_t> {};
+
+	template<typename member_t, typename class_t>
+		requires (!std::is_function_v<member_t>)
+	struct known_arity<member_t class_t::*> : arity_of<1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...)> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) volatile> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const volatile> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) &> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const&> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) volatile&> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const volatile&> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) &&> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const&&> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) volatile&&> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const volatile&&> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) volatile noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const volatile noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) & noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const& noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) volatile& noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const volatile& noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) && noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const&& noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) volatile&& noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct known_arity<ret_t(class_t::*)(params_t...) const volatile&& noexcept> : arity_of<sizeof...(params_t) + 1, false> {};
+
+	template<typename t>
+		requires std::is_class_v<t> && requires { requires std::is_member_function_pointer_v<decltype(&t::operator())>; known_arity<decltype(&t::operator())>::value; }
+	struct known_arity<t> : arity_of<known_arity<decltype(&t::operator())>::value - 1, true> {};
+
+	template<typename t>
+	struct known_arity<std::reference_wrapper<t>> : known_arity<std::remove_cv_t<t>> {};
+
+	//Placeholders among the bound arguments still have to be filled, so they don't count towards the arguments already given
+	template<typename callable_t, typename...bound_ts>
+		requires requires { known_arity<callable_t>::value; } && (known_arity<callable_t>::value >= sizeof...(bound_ts) - placeholder_count<bound_ts...>)
+	struct known_arity<partial_application<callable_t, bound_ts...>> :
+		arity_of<known_arity<callable_t>::value - (sizeof...(bound_ts) - placeholder_count<bound_ts...>), known_arity<callable_t>::may_default> {};
+
+	template<typename forwarding_callable_t, typename args_tuple_t, std::size_t...is>
+	static constexpr bool is_invocable_with_prefix(std::index_sequence<is...>)
+	{
+		return std::is_invocable_v<forwarding_callable_t, std::tuple_element_t<is, args_tuple_t>...>;
+	}
+
+	//The smallest number, from first up to last, of the leading elements of args_tuple_t that forwarding_callable_t is invocable with, or 0 if there is none
+	//Prefixes are still checked from shortest to longest, stopping at the first invocable one, since checking a longer one could instantiate
+	//the body of a generic callable with arguments it can't take. But the range is split in halves rather than walked one prefix at a time,
+	//with the second half only searched if the first has no invocable prefix, so instantiations only nest logarithmically deep in the number of arguments
+	template<typename forwarding_callable_t, typename args_tuple_t, std::size_t first, std::size_t last>
+	static constexpr std::size_t saturation_point()
+	{
+		if constexpr (first > last)
+		{
+			return 0;
+		}
+		else if constexpr (first == last)
+		{
+			return is_invocable_with_prefix<forwarding_callable_t, args_tuple_t>(std::make_index_sequence<first>{}) ? first : 0;
+		}
+		else
+		{
+			constexpr std::size_t middle = first + (last - first) / 2;
+			constexpr std::size_t found = saturation_point<forwarding_callable_t, args_tuple_t, first, middle>();
+
+			if constexpr (found != 0)
+			{
+				return found;
+			}
+			else
+			{
+				return saturation_point<forwarding_callable_t, args_tuple_t, middle + 1, last>();
+			}
+		}
+	}
+
+	//Invokes a callable that is known to be saturated by args, wrapping up the result if there is one
+	//Prvalue results are never materialized outside of the curry returned, so large results aren't moved and non-movable ones work too
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr auto saturate(forwarding_callable_t&& callable, args_t&&...args)
+		noexcept(is_nothrow_saturating<forwarding_callable_t, args_t...>())
+	{
+		using ret_t = std::invoke_result_t<forwarding_callable_t, args_t...>;
+
+		if constexpr (std::is_void_v<ret_t>)
+		{
+			std::invoke(std::forward<forwarding_callable_t>(callable), std::forward<args_t>(args)...);
+		}
+		else if constexpr (is_wrapped_in_place<ret_t>)
+		{
+			return wrapped_result_t<ret_t>{invoke_in_place_t{}, std::forward<forwarding_callable_t>(callable), std::forward<args_t>(args)...};
+		}
+		else if constexpr (std::is_same_v<ret_t, wrapped_result_t<ret_t>>)
+		{
+			return std::invoke(std::forward<forwarding_callable_t>(callable), std::forward<args_t>(args)...);
+		}
+		else
+		{
+			return handle_invoke_result(std::invoke(std::forward<forwarding_callable_t>(callable), std::forward<args_t>(args)...));
+		}
+	}
+
+	//Saturates callable with the first sizeof...(is) referenced arguments and then applies the rest of them to the result
+	template<typename forwarding_callable_t, typename arg_refs_t, std::size_t...is, std::size_t...js>
+	static constexpr auto apply_split(forwarding_callable_t&& callable, arg_refs_t&& arg_refs, std::index_sequence<is...>, std::index_sequence<js...>)
+		noexcept(noexcept(saturate(std::declval<forwarding_callable_t>(), std::get<is>(std::declval<arg_refs_t>())...)(std::get<sizeof...(is) + js>(std::declval<arg_refs_t>())...)))
+	{
+		return saturate(std::forward<forwarding_callable_t>(callable), std::get<is>(std::move(arg_refs))...)(std::get<sizeof...(is) + js>(std::move(arg_refs))...);
+	}
+
+	//find_saturation_point for arguments that don't include any placeholders
+	//When the arity is known this is decided with one or two invocability checks rather than one for each prefix
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr std::size_t find_unplaced_saturation_point()
+	{
+		using arity_t = known_arity<std::remove_cvref_t<forwarding_callable_t>>;
+		using args_tuple_t = std::tuple<args_t...>;
+		constexpr std::size_t count = sizeof...(args_t);
+
+		if constexpr (requires { arity_t::value; })
+		{
+			constexpr std::size_t arity = arity_t::value;
+
+			if constexpr (arity == 0)
+			{
+				return 0;
+			}
+			else if constexpr (arity <= count)
+			{
+				constexpr bool saturates = is_invocable_with_prefix<forwarding_callable_t, args_tuple_t>(std::make_index_sequence<arity>{});
+
+				if constexpr (!arity_t::may_default)
+				{
+					return saturates ? arity : 0;
+				}
+				//Default arguments are trailing, so if the last parameter needs an argument then so do all of the others
+				else if constexpr (saturates && (arity == 1 || !is_invocable_with_prefix<forwarding_callable_t, args_tuple_t>(std::make_index_sequence<arity - 1>{})))
+				{
+					return arity;
+				}
+			}
+			//Likewise, a default argument for any parameter after these would have made all of them together invocable
+			else if constexpr (!arity_t::may_default || !is_invocable_with_prefix<forwarding_callable_t, args_tuple_t>(std::make_index_sequence<count>{}))
+			{
+				return 0;
+			}
+		}
+
+		return saturation_point<forwarding_callable_t, args_tuple_t, 1, count>();
+	}
+
+	template<typename forwarding_callable_t, typename args_tuple_t, std::size_t...is>
+	static constexpr std::size_t find_unplaced_saturation_point(std::index_sequence<is...>)
+	{
+		return find_unplaced_saturation_point<forwarding_callable_t, std::tuple_element_t<is, args_tuple_t>...>();
+	}
+
+	//The number of leading args_t that forwarding_callable_t should be invoked with, or 0 if they should all be bound
+	//A callable is never invoked with a placeholder, so only the arguments before the first one are considered
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr std::size_t find_saturation_point()
+	{
+		if constexpr (placeholder_count<args_t...> == 0)
+		{
+			return find_unplaced_saturation_point<forwarding_callable_t, args_t...>();
+		}
+		else
+		{
+			return find_unplaced_saturation_point<forwarding_callable_t, std::tuple<args_t...>>(std::make_index_sequence<first_placeholder<args_t...>()>{});
+		}
+	}
+
+	//Whether applying the referenced arguments after the first sizeof...(is) to the result of saturating with those is well formed
+	//Only looks at the type of the result, so that nothing is instantiated which would fail outside of an immediate context
+	template<typename forwarding_callable_t, typename arg_refs_t, std::size_t...is, std::size_t...js>
+	static constexpr bool is_split_applicable(std::index_sequence<is...>, std::index_sequence<js...>)
+	{
+		using saturated_t = decltype(saturate(std::declval<forwarding_callable_t>(), std::get<is>(std::declval<arg_refs_t>())...));
+		return std::is_invocable_v<saturated_t, std::tuple_element_t<sizeof...(is) + js, arg_refs_t>...>;
+	}
+
+	//Whether do_apply<forwarding_callable_t, args_t...> is well formed, following the same choice of strategy as it does
+	//This is what constrains curry<t>::operator(), so that applying arguments which can't be bound (such as lvalues of move-only types) is rejected rather than a hard error
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr bool is_applicable()
+	{
+		if constexpr (sizeof...(args_t) == 0)
+		{
+			return std::is_invocable_v<forwarding_callable_t>;
+		}
+		else
+		{
+			constexpr std::size_t saturated_at = find_saturation_point<forwarding_callable_t, args_t...>();
+
+			if constexpr (saturated_at == 0)
+			{
+				return is_partially_applicable<forwarding_callable_t, args_t...>();
+			}
+			else if constexpr (saturated_at == sizeof...(args_t))
+			{
+				return true;
+			}
+			else
+			{
+				return is_split_applicable<forwarding_callable_t, std::tuple<args_t&&...>>(std::make_index_sequence<saturated_at>{}, std::make_index_sequence<sizeof...(args_t) - saturated_at>{});
+			}
+		}
+	}
+
+	//Whether do_apply<forwarding_callable_t, args_t...> is noexcept, following the same choice of strategy as it does
+	template<typename forwarding_callable_t, typename...args_t>
+	static constexpr bool is_nothrow_applicable()
+	{
+		constexpr std::size_t saturated_at = find_saturation_point<forwarding_callable_t, args_t...>();
+
+		if constexpr (saturated_at == 0)
+		{
+			return is_nothrow_partially_applicable<forwarding_callable_t, args_t...>();
+		}
+		else if constexpr (saturated_at == sizeof...(args_t))
+		{
+			return is_nothrow_saturating<forwarding_callable_t, args_t...>();
+		}
+		else
+		{
+			return noexcept(apply_split(std::declval<forwarding_callable_t>(), std::declval<std::tuple<args_t&&...>>(),
+				std::make_index_sequence<saturated_at>{}, std::make_index_sequence<sizeof...(args_t) - saturated_at>{}));
+		}
+	}
+
+	//Arguments are perfect forwarded up to the point where callable is saturated, and are only decay-copied if they need to be bound
 	template<typename forwarding_callable_t, typename arg1_t, typename...args_t>
 	static constexpr auto do_apply(forwarding_callable_t&& callable, arg1_t&& arg1, args_t&&...args)
+		noexcept(is_nothrow_applicable<forwarding_callable_t, arg1_t, args_t...>())
+		requires (is_applicable<forwarding_callable_t, arg1_t, args_t...>())
 	{
-		return do_apply(std::forward<forwarding_callable_t>(callable),std::forward<arg1_t>(arg1))(std::forward<args_t>(args)...);
+		constexpr std::size_t saturated_at = find_saturation_point<forwarding_callable_t, arg1_t, args_t...>();
+
+		if constexpr (saturated_at == 0)
+		{
+			return partially_apply_curried(std::forward<forwarding_callable_t>(callable), std::forward<arg1_t>(arg1), std::forward<args_t>(args)...);
+		}
+		else if constexpr (saturated_at == 1 + sizeof...(args_t))
+		{
+			return saturate(std::forward<forwarding_callable_t>(callable), std::forward<arg1_t>(arg1), std::forward<args_t>(args)...);
+		}
+		else
+		{
+			return apply_split(std::forward<forwarding_callable_t>(callable), std::forward_as_tuple(std::forward<arg1_t>(arg1), std::forward<args_t>(args)...),
+				std::make_index_sequence<saturated_at>{}, std::make_index_sequence<1 + sizeof...(args_t) - saturated_at>{});
+		}
 	}
 	
 	template<typename forwarding_callable_t>
 	static constexpr void do_apply(forwarding_callable_t&& callable)
+		noexcept(is_nothrow_callable_v<forwarding_callable_t>)
 		requires (std::is_void_v<std::invoke_result_t<forwarding_callable_t>>)
 	{
 		std::invoke(std::forward<forwarding_callable_t>(callable));
@@ -97,92 +914,175 @@ public:
 
 	template<typename forwarding_callable_t>
 	static constexpr auto do_apply(forwarding_callable_t&& callable)
+		noexcept(is_nothrow_saturating<forwarding_callable_t>())
 		requires (!std::is_void_v<std::invoke_result_t<forwarding_callable_t>>)
 	{
-		return handle_invoke_result(std::invoke(std::forward<forwarding_callable_t>(callable)));
+		return saturate(std::forward<forwarding_callable_t>(callable));
 	}
 
-	//needed for the deduction guide
+	//Whether a class's only operator() is const qualified, so that invoking a copy of it can't modify any state that invoking the original would
+	template<typename t>
+	struct is_const_call_operator : std::false_type {};
+
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct is_const_call_operator<ret_t(class_t::*)(params_t...) const> : std::true_type {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct is_const_call_operator<ret_t(class_t::*)(params_t...) const noexcept> : std::true_type {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct is_const_call_operator<ret_t(class_t::*)(params_t...) const&> : std::true_type {};
+	template<typename ret_t, typename class_t, typename...params_t>
+	struct is_const_call_operator<ret_t(class_t::*)(params_t...) const& noexcept> : std::true_type {};
+
+	template<typename t>
+	static constexpr bool has_const_call_operator()
+	{
+		if constexpr (requires { &t::operator(); })
+		{
+			return is_const_call_operator<decltype(&t::operator())>::value;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	//Whether curry<t>::operator() called on an lvalue passes a copy of the wrapped t along, rather than a std::ref to it
+	//A copy of a small trivially copyable callable is cheaper to bind and call than a reference, and doesn't depend on the original's lifetime
+	//This is only done when invoking the copy can't behave any differently from invoking the original:
+	//for function and member pointers, empty classes (such as stateless lambdas), and classes with only a const operator() (lambdas that aren't mutable)
+	//Except for a const operator() changing mutable members, which then changes the copy, where applying through the std::ref used to change the original
+	//Such a callable can still be bound by reference, by wrapping it in std::ref explicitly or by specializing this to false, as the optional headers do for their own types
+	//Checks trivial copy construction and destruction rather than std::is_trivially_copyable, which is all a copy needs
+	//gcc 12 answers std::is_trivially_copyable differently for a closure type depending on whether it was asked before, so it could pick differently for the same type
 	template<typename t>
+	static constexpr bool copies_on_lvalue_application = std::is_trivially_copy_constructible_v<t> && std::is_trivially_destructible_v<t> && sizeof(t) <= 2 * sizeof(void*) &&
+		(!std::is_class_v<t> || std::is_empty_v<t> || has_const_call_operator<t>());
+
+	//What curry<t>::operator() called on an lvalue applies its arguments to, following copies_on_lvalue_application
+	template<typename t>
+	static constexpr auto lvalue_callable(t& callable) noexcept
+	{
+		if constexpr (copies_on_lvalue_application<std::remove_const_t<t>>)
+		{
+			return callable;
+		}
+		else
+		{
+			return std::ref(callable);
+		}
+	}
+
+	//needed for the deduction guide
+	//void is matched by a partial specialization (hence the unused second parameter), since gcc doesn't accept explicit specializations in class scope
+	template<typename t, typename = void>
 	struct unwrap_do_apply_result {};
 
-	template<>
-	struct unwrap_do_apply_result<void> 
+	template<typename unused_t>
+	struct unwrap_do_apply_result<void, unused_t>
 	{
 		using type = void;
 	};
 
 	template<typename t>
-	struct unwrap_do_apply_result<curry<t>>
+	struct unwrap_do_apply_result<curry<t>, void>
 	{
 		using type = t;
 	};
+
+	//What curry{callable, arg1, args...} results in, worked out once and shared by the deduction guide and the constructor it deduces
+	//type is the type wrapped by the resulting curry (or void), and is_nothrow is whether the application can throw
+	template<typename c_callable_t, typename...args_t>
+	struct bound_construction
+	{
+		using type = typename unwrap_do_apply_result<decltype(do_apply(std::declval<c_callable_t>(), std::declval<args_t>()...))>::type;
+		static constexpr bool is_nothrow = noexcept(do_apply(std::declval<c_callable_t>(), std::declval<args_t>()...));
+	};
 };
 
-//Wraps a function so that it may be called with any number of parameters, std::bind_front-ing them one at a time
+//Wraps a function so that it may be called with any number of parameters, binding them one at a time as std::bind_front would
+//Bound arguments are accumulated in a single flat curry<void>::partial_application rather than nested layers
 //Functions with no parameters are treated as if they take a unit type, and must be explicitly empty-invoked
 //Use curry<std::reference_wrapper<...>> or construct via curry{std::ref(...)} to capture the callable by reference
 //Calling operator() by (lvalue) reference behaves like passing a std::ref of the wrapped callable to std::bind_front
+//The exception is small trivially copyable callables which would behave the same either way, which are copied instead
 //To have the callable stored by value, explicitly std::move or copy construct if it isnt already being used as an rvalue
 //Note the implications of this: when a callable is stored by reference, it can no longer have its rvalue operator() called
 //So, be sure to consider std::move-ing your curried callables when calling operator() to avoid unnecessary copying
-//Because applications are done via std::bind_front, std::ref and std::cref can be used on arguments to avoid copies.
+//Because applications follow std::bind_front semantics, std::ref and std::cref can be used on arguments to avoid copies.
 template<typename callable_t>
 class curry
 {
 private:
 
-	//The wrapped value
-	callable_t wrapped;
+	//The wrapped value, which takes up no space in the layout of any enclosing object if it is empty
+	CURRY_NO_UNIQUE_ADDRESS curry<void>::wrapped_value<callable_t> wrapped;
 
 public:
 
-	constexpr curry(callable_t callable) : wrapped(std::move(callable)) {}
+	//Taken by reference rather than by value, so that the callable is copied or moved into place once, rather than into a parameter first
+	constexpr curry(callable_t const& callable) noexcept(std::is_nothrow_copy_constructible_v<callable_t>) : wrapped(std::in_place, callable) {}
+
+	constexpr curry(callable_t&& callable) noexcept(std::is_nothrow_move_constructible_v<callable_t>) : wrapped(std::in_place, std::move(callable)) {}
+
+	//Initializes the wrapped value directly from the result of invoking callable with args, which is how saturated applications wrap up prvalue results
+	template<typename c_callable_t, typename...args_t>
+	constexpr curry(curry<void>::invoke_in_place_t, c_callable_t&& callable, args_t&&...args)
+		noexcept(curry<void>::is_nothrow_callable_v<c_callable_t, args_t...>) :
+		wrapped(curry<void>::invoke_in_place_t{}, std::forward<c_callable_t>(callable), std::forward<args_t>(args)...) {}
 
 	template<typename c_callable_t, typename arg1_t, typename...args_t>
-	constexpr curry(c_callable_t&& callable, arg1_t&& arg1, args_t&&...args) : 
+	constexpr curry(c_callable_t&& callable, arg1_t&& arg1, args_t&&...args)
+		noexcept(curry<void>::bound_construction<c_callable_t, arg1_t, args_t...>::is_nothrow && std::is_nothrow_move_constructible_v<callable_t>) :
 		curry(curry<void>::do_apply(std::forward<c_callable_t>(callable), std::forward<arg1_t>(arg1), std::forward<args_t>(args)...)) {}
 	
-	constexpr operator callable_t&() &
+	constexpr operator callable_t&() & noexcept
 	{
-		return wrapped;
+		return wrapped.value;
 	}
-	constexpr operator callable_t const&() const&
+	constexpr operator callable_t const&() const& noexcept
 	{
-		return wrapped;
+		return wrapped.value;
 	}
-	constexpr operator callable_t&&() &&
+	constexpr operator callable_t&&() && noexcept
 	{
-		return std::move(wrapped);
+		return std::move(wrapped.value);
 	}
-	constexpr operator callable_t const&&() const&&
+	constexpr operator callable_t const&&() const&& noexcept
 	{
-		return std::move(wrapped);
+		return std::move(wrapped.value);
 	}
 
 
 	template<typename...args_t>
-	constexpr auto operator()(args_t...args) &
+		requires (curry<void>::is_applicable<decltype(curry<void>::lvalue_callable(std::declval<callable_t&>())), args_t...>())
+	constexpr auto operator()(args_t&&...args) &
+		noexcept(noexcept(curry<void>::do_apply(curry<void>::lvalue_callable(std::declval<callable_t&>()),std::declval<args_t>()...)))
 	{
-		return curry<void>::do_apply(std::ref(wrapped),std::forward<args_t>(args)...);
+		return curry<void>::do_apply(curry<void>::lvalue_callable(wrapped.value),std::forward<args_t>(args)...);
 	}
 
 	template<typename...args_t>
-	constexpr auto operator()(args_t...args) const&
+		requires (curry<void>::is_applicable<decltype(curry<void>::lvalue_callable(std::declval<callable_t const&>())), args_t...>())
+	constexpr auto operator()(args_t&&...args) const&
+		noexcept(noexcept(curry<void>::do_apply(curry<void>::lvalue_callable(std::declval<callable_t const&>()),std::declval<args_t>()...)))
 	{
-		return curry<void>::do_apply(std::ref(wrapped),std::forward<args_t>(args)...);
+		return curry<void>::do_apply(curry<void>::lvalue_callable(wrapped.value),std::forward<args_t>(args)...);
 	}
 
 	template<typename...args_t>
-	constexpr auto operator()(args_t...args) &&
+		requires (curry<void>::is_applicable<callable_t, args_t...>())
+	constexpr auto operator()(args_t&&...args) &&
+		noexcept(noexcept(curry<void>::do_apply(std::declval<callable_t>(),std::declval<args_t>()...)))
 	{
-		return curry<void>::do_apply(std::move(wrapped),std::forward<args_t>(args)...);
+		return curry<void>::do_apply(std::move(wrapped.value),std::forward<args_t>(args)...);
 	}
 
 	template<typename...args_t>
-	constexpr auto operator()(args_t...args) const&&
+		requires (curry<void>::is_applicable<callable_t const, args_t...>())
+	constexpr auto operator()(args_t&&...args) const&&
+		noexcept(noexcept(curry<void>::do_apply(std::declval<callable_t const>(),std::declval<args_t>()...)))
 	{
-		return curry<void>::do_apply(std::move(wrapped),std::forward<args_t>(args)...);
+		return curry<void>::do_apply(std::move(wrapped.value),std::forward<args_t>(args)...);
 	}
 
 	constexpr curry() = default;
@@ -194,30 +1094,34 @@ public:
 
 	template<typename t>
 		requires (!std::same_as<callable_t,t>) && std::constructible_from<callable_t, t const&>
-	constexpr curry(curry<t> const& rhs) : wrapped(static_cast<t const&>(rhs.wrapped)) {}
+	constexpr curry(curry<t> const& rhs) noexcept(std::is_nothrow_constructible_v<callable_t, t const&>) : wrapped(std::in_place, static_cast<t const&>(rhs)) {}
 
 	template<typename t>
 		requires (!std::same_as<callable_t,t>) && std::constructible_from<callable_t, t&&>
-	constexpr curry(curry<t>&& rhs) : wrapped(static_cast<t&&>(std::move(rhs))) {}
+	constexpr curry(curry<t>&& rhs) noexcept(std::is_nothrow_constructible_v<callable_t, t&&>) : wrapped(std::in_place, static_cast<t&&>(std::move(rhs))) {}
 
 	template<typename t>
 		requires (!std::same_as<callable_t,t>) && std::assignable_from<callable_t&, t const&>
-	constexpr curry& operator=(curry<t> const& rhs) 
+	constexpr curry& operator=(curry<t> const& rhs) noexcept(std::is_nothrow_assignable_v<callable_t&, t const&>)
 	{
-		wrapped = static_cast<t&&>(std::move(rhs));
+		wrapped.value = static_cast<t const&>(rhs);
 		return *this;
 	}
 
 	template<typename t>
 		requires (!std::same_as<callable_t,t>) && std::assignable_from<callable_t&, t&&>
-	constexpr curry& operator=(curry<t>&& rhs)
+	constexpr curry& operator=(curry<t>&& rhs) noexcept(std::is_nothrow_assignable_v<callable_t&, t&&>)
 	{
-		wrapped = static_cast<t&&>(std::move(rhs));
+		wrapped.value = static_cast<t&&>(std::move(rhs));
 		return *this;
 	}
 
 };
 
+//Deduces the decayed type of the callable, as a constructor taking it by value would
+template<typename callable_t>
+curry(callable_t) -> curry<callable_t>;
+
 template<typename c_callable_t, typename arg1_t, typename...args_t>
 curry(c_callable_t&& callable, arg1_t&& arg1, args_t&&...args) ->
-	curry<typename curry<void>::unwrap_do_apply_result<decltype(curry<void>::do_apply(std::forward<c_callable_t>(callable), std::forward<arg1_t>(arg1), std::forward<args_t>(args)...))>::type>;
\ No newline at end of file
+	curry<typename curry<void>::bound_construction<c_callable_t, arg1_t, args_t...>::type>;
\ No newline at end of file
@@ -0,0 +1,36 @@
+/*
+Overview of this file:
+
+The module currying, which exports the same names as currying.h, so that import currying; can be used in place of #include "currying.h"
+
+The headers are included in the global module fragment, so the declarations are exactly those of the headers, with identical semantics
+They are parsed once, when this interface unit is compiled, rather than in every translation unit that uses them
+Macros such as CURRY_NO_UNIQUE_ADDRESS aren't exported, and the optional headers still have to be included rather than imported
+*/
+
+
+module;
+
+#include "currying.h"
+
+export module currying;
+
+//curry.h
+export using ::curry;
+export using ::curry_placeholder;
+
+export namespace curry_placeholders
+{
+	using curry_placeholders::_;
+}
+
+//curried.h
+export using ::curried;
+export using ::is_curried;
+export using ::is_curried_v;
+
+//uncurry.h
+export using ::uncurry;
+export using ::uncurried;
+export using ::uncurried_t;
+export using ::curry_apply;
@@ -0,0 +1,294 @@
+/*
+Overview of this file:
+
+dispatch<ret_t(args_t...), keys...>(handlers...): returns a curry around a dispatch_table, which takes a key followed by args_t..., and invokes the handler for that key
+
+dispatch_table<signature_t, dispatch_keys<keys...>, handlers_t...>: the callable wrapped by dispatch, holding the handlers and a table of entry points into them, built at compile time
+
+dispatch_keys<keys...>: the keys of a dispatch_table, one per handler, along with how they are looked up
+*/
+
+
+#pragma once
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<stdexcept>
+#include<type_traits>
+#include<utility>
+#include "curry.h"
+
+
+//The keys of a dispatch_table, which have to be distinct values of one integral or enum type
+//Keys are looked up by one of two methods, picked at compile time:
+//If at least half of the values between the smallest and largest key are keys, the slot is the key minus the smallest key (a dense jump table)
+//Otherwise it is a multiplicative hash of the key, whose multiplier is searched for at compile time so that no two keys share a slot (a perfect hash)
+//Either way, keys that aren't in the table are never mistaken for ones that are: they fall outside of the dense range, or don't match the key held in their slot
+template<auto...keys>
+struct dispatch_keys
+{
+	static_assert(sizeof...(keys) != 0, "a dispatch table needs at least one key");
+
+	using key_type = std::common_type_t<decltype(keys)...>;
+
+	static_assert((std::is_same_v<decltype(keys), key_type> && ...), "all keys of a dispatch table have to be of the same type");
+	static_assert(std::is_integral_v<key_type> || std::is_enum_v<key_type>, "the keys of a dispatch table have to be integers or enums");
+
+	static constexpr std::size_t count = sizeof...(keys);
+
+	//The key as an unsigned 64 bit value, which preserves the distances between keys (modulo 2^64) whether or not key_type is signed
+	static constexpr std::uint64_t value_of(key_type key) noexcept
+	{
+		if constexpr (std::is_enum_v<key_type>)
+		{
+			return static_cast<std::uint64_t>(static_cast<std::underlying_type_t<key_type>>(key));
+		}
+		else
+		{
+			return static_cast<std::uint64_t>(key);
+		}
+	}
+
+	static constexpr std::array<key_type, count> values{keys...};
+
+	static constexpr key_type smallest() noexcept
+	{
+		key_type result = values[0];
+		for(key_type key : values)
+		{
+			if(key < result)
+			{
+				result = key;
+			}
+		}
+		return result;
+	}
+
+	static constexpr key_type largest() noexcept
+	{
+		key_type result = values[0];
+		for(key_type key : values)
+		{
+			if(result < key)
+			{
+				result = key;
+			}
+		}
+		return result;
+	}
+
+	static constexpr bool are_distinct() noexcept
+	{
+		for(std::size_t i = 0; i != count; ++i)
+		{
+			for(std::size_t j = i + 1; j != count; ++j)
+			{
+				if(values[i] == values[j])
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	static_assert(are_distinct(), "the keys of a dispatch table have to be distinct");
+
+	static constexpr std::uint64_t span = value_of(largest()) - value_of(smallest());
+
+	static constexpr bool is_dense = span < 2 * count;
+
+	//The number of bits of the hash, which starts at giving each key at least two slots, and grows until a perfect hash is found
+	//The multiplier is an odd multiple of 2^64 divided by the golden ratio, which is odd itself, tried in turn until no two keys share a slot
+	struct hash_parameters
+	{
+		unsigned bits = 0;
+		std::uint64_t multiplier = 0;
+	};
+
+	static constexpr std::size_t hash(std::uint64_t value, hash_parameters parameters) noexcept
+	{
+		return static_cast<std::size_t>((value * parameters.multiplier) >> (64 - parameters.bits));
+	}
+
+	//Gives up (leaving bits past 16, which fails the static_assert below) if there is no perfect hash with at most 2^16 slots
+	static constexpr hash_parameters find_hash_parameters() noexcept
+	{
+		unsigned bits = 1;
+		while((std::size_t(1) << bits) < 2 * count)
+		{
+			++bits;
+		}
+
+		for(; bits <= 16; ++bits)
+		{
+			for(std::uint64_t attempt = 0; attempt != 256; ++attempt)
+			{
+				hash_parameters const parameters{bits, 0x9e3779b97f4a7c15ull * (2 * attempt + 1)};
+
+				bool is_perfect = true;
+				for(std::size_t i = 0; i != count && is_perfect; ++i)
+				{
+					for(std::size_t j = i + 1; j != count && is_perfect; ++j)
+					{
+						is_perfect = hash(value_of(values[i]), parameters) != hash(value_of(values[j]), parameters);
+					}
+				}
+
+				if(is_perfect)
+				{
+					return parameters;
+				}
+			}
+		}
+		return hash_parameters{bits, 0};
+	}
+
+	static constexpr hash_parameters parameters = is_dense ? hash_parameters{} : find_hash_parameters();
+
+	static_assert(is_dense || parameters.bits <= 16, "too many keys for a dispatch table");
+
+	static constexpr std::size_t slot_count = is_dense ? static_cast<std::size_t>(span) + 1 : std::size_t(1) << parameters.bits;
+
+	static constexpr std::size_t slot_of(key_type key) noexcept
+	{
+		if constexpr (is_dense)
+		{
+			return static_cast<std::size_t>(value_of(key) - value_of(smallest()));
+		}
+		else
+		{
+			return hash(value_of(key), parameters);
+		}
+	}
+
+	//Which key each slot holds, as an index into keys..., or count for an empty slot
+	static constexpr std::array<std::size_t, slot_count> slot_indices = []()
+	{
+		std::array<std::size_t, slot_count> result{};
+		for(std::size_t& index : result)
+		{
+			index = count;
+		}
+		for(std::size_t i = 0; i != count; ++i)
+		{
+			result[slot_of(values[i])] = i;
+		}
+		return result;
+	}();
+
+	//The key held in each slot, so that a hashed key can be checked with a single comparison
+	//Empty slots hold the first key, which can't be looked up there since it is held in a slot of its own
+	static constexpr std::array<key_type, slot_count> slot_keys = []()
+	{
+		std::array<key_type, slot_count> result{};
+		for(std::size_t slot = 0; slot != slot_count; ++slot)
+		{
+			result[slot] = values[slot_indices[slot] == count ? 0 : slot_indices[slot]];
+		}
+		return result;
+	}();
+
+	//The slot of key, or slot_count if key can't be in the table
+	//A dense table only needs a bounds check, since its empty slots are known not to hold a key, whereas a hashed table checks the key held in the slot
+	static constexpr std::size_t lookup(key_type key) noexcept
+	{
+		std::size_t const slot = slot_of(key);
+		if constexpr (is_dense)
+		{
+			return slot < slot_count ? slot : slot_count;
+		}
+		else
+		{
+			return slot_keys[slot] == key ? slot : slot_count;
+		}
+	}
+
+	static constexpr bool contains(key_type key) noexcept
+	{
+		std::size_t const slot = lookup(key);
+		return slot != slot_count && slot_indices[slot] != count;
+	}
+};
+
+template<typename signature_t, typename keys_t, typename...handlers_t>
+class dispatch_table;
+
+//Invokes the handler for a key with the rest of its arguments, through a single indirect call to an entry point for that handler
+//The entry points are function pointers held in a static table, one per slot of keys_t, so nothing is type erased or allocated
+//Handlers are held in one curry<void>::packed_storage, so a table of stateless handlers is empty
+//They are invoked as const lvalues, with all of args_t at once, and their results are converted to ret_t
+//Its single non-template operator() lets curry split the arguments at the right place without probing, so dispatch(...)(key)(args)... works
+template<typename ret_t, typename...args_t, auto...keys, typename...handlers_t>
+class dispatch_table<ret_t(args_t...), dispatch_keys<keys...>, handlers_t...>
+{
+public:
+
+	using keys_type = dispatch_keys<keys...>;
+	using key_type = typename keys_type::key_type;
+
+	static_assert(sizeof...(handlers_t) == keys_type::count, "a dispatch table needs exactly one handler for each key");
+	static_assert((std::is_invocable_r_v<ret_t, handlers_t const&, args_t...> && ...), "every handler has to be invocable with the arguments of the signature, returning something convertible to its result");
+
+private:
+
+	using storage_t = curry<void>::packed_storage<std::index_sequence_for<handlers_t...>, handlers_t...>;
+	using entry_t = ret_t(*)(storage_t const&, args_t...);
+
+	CURRY_NO_UNIQUE_ADDRESS storage_t storage;
+
+	template<std::size_t i>
+	static constexpr ret_t entry(storage_t const& storage, args_t...args)
+	{
+		return std::invoke(storage.template get<i>(), std::forward<args_t>(args)...);
+	}
+
+	static constexpr ret_t missing_entry(storage_t const&, args_t...)
+	{
+		throw std::out_of_range("no handler in the dispatch table for this key");
+	}
+
+	template<std::size_t...is>
+	static constexpr std::array<entry_t, keys_type::slot_count + 1> make_entries(std::index_sequence<is...>) noexcept
+	{
+		std::array<entry_t, sizeof...(is) + 1> const by_index{&entry<is>..., &missing_entry};
+		std::array<entry_t, keys_type::slot_count + 1> result{};
+		for(std::size_t slot = 0; slot != keys_type::slot_count; ++slot)
+		{
+			result[slot] = by_index[keys_type::slot_indices[slot]];
+		}
+		result[keys_type::slot_count] = &missing_entry;
+		return result;
+	}
+
+	//The entry point for each slot of keys_type, plus one past the end, so empty slots and keys that aren't in the table reach missing_entry
+	static constexpr std::array<entry_t, keys_type::slot_count + 1> entries = make_entries(std::index_sequence_for<handlers_t...>{});
+
+public:
+
+	template<typename...c_handlers_t>
+	constexpr explicit dispatch_table(std::in_place_t, c_handlers_t&&...handlers) noexcept((std::is_nothrow_constructible_v<handlers_t, c_handlers_t> && ...)) :
+		storage(std::in_place, std::forward<c_handlers_t>(handlers)...) {}
+
+	//Whether there is a handler for key, since invoking the table with any other key throws std::out_of_range
+	static constexpr bool contains(key_type key) noexcept
+	{
+		return keys_type::contains(key);
+	}
+
+	constexpr ret_t operator()(key_type key, args_t...args) const
+	{
+		return entries[keys_type::lookup(key)](storage, std::forward<args_t>(args)...);
+	}
+};
+
+//Builds a dispatch table from one handler per key, with handlers[i] invoked for keys[i], returning a curry around it
+//Every handler has to be invocable as ret_t(args_t...), and handlers which are curries are applied all of args_t at once, so they saturate in one step
+//So dispatch<int(int, int), op::add, op::mul>(curry{add}, curry{mul})(op)(x)(y) invokes add or mul through a single indirect call
+template<typename signature_t, auto...keys, typename...handlers_t>
+	requires std::is_function_v<signature_t>
+constexpr auto dispatch(handlers_t&&...handlers)
+{
+	return curry{dispatch_table<signature_t, dispatch_keys<keys...>, std::decay_t<handlers_t>...>{std::in_place, std::forward<handlers_t>(handlers)...}};
+}
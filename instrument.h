@@ -0,0 +1,307 @@
+/*
+Overview of this file:
+
+curry_instrumented<site_t, enabled>(f): returns a curry around f which counts its saturations, partial applications and copies and moves, along with those of its bound arguments
+Only does so if enabled, which defaults to whether CURRY_INSTRUMENTATION is defined, and otherwise just returns curry{f}, so that it costs nothing
+
+curry_stats<site_t>(): the counts recorded so far for a site, as a curry_counts
+
+reset_curry_stats<site_t>(): sets the counts recorded for a site back to zero
+
+instrumented<callable_t, site_t>: the callable wrapped by curry_instrumented, which is invoked exactly like callable_t
+
+counted_argument<t, site_t>: how arguments bound to an instrumented are stored, which counts its copies and moves
+*/
+
+
+#pragma once
+#include<atomic>
+#include<cstddef>
+#include<functional>
+#include<type_traits>
+#include<utility>
+#include "curry.h"
+
+
+//A snapshot of the counts recorded for one site
+//saturations: invocations of the wrapped callable
+//partial_applications: partial applications of the callable constructed, whether from the callable itself or by binding more arguments to another one
+//bound_arguments: arguments bound to partial applications of the callable
+//callable_copies, callable_moves: copies and moves of the callable, including into and out of partial applications
+//argument_copies, argument_moves: copies and moves of arguments after they were bound, such as when a partial application is copied
+struct curry_counts
+{
+	std::size_t saturations = 0;
+	std::size_t partial_applications = 0;
+	std::size_t bound_arguments = 0;
+	std::size_t callable_copies = 0;
+	std::size_t callable_moves = 0;
+	std::size_t argument_copies = 0;
+	std::size_t argument_moves = 0;
+};
+
+//The counters for one site, which can be any type, such as a tag struct declared where the curry is created
+//They are only ever incremented, so relaxed atomics suffice, and curries can be used from multiple threads
+template<typename site_t>
+struct instrumentation_counters
+{
+	static inline std::atomic<std::size_t> saturations{0};
+	static inline std::atomic<std::size_t> partial_applications{0};
+	static inline std::atomic<std::size_t> bound_arguments{0};
+	static inline std::atomic<std::size_t> callable_copies{0};
+	static inline std::atomic<std::size_t> callable_moves{0};
+	static inline std::atomic<std::size_t> argument_copies{0};
+	static inline std::atomic<std::size_t> argument_moves{0};
+
+	//Counting is skipped during constant evaluation, so that instrumented curries are still usable in constant expressions
+	static constexpr void count(std::atomic<std::size_t>& counter) noexcept
+	{
+		if(!std::is_constant_evaluated())
+		{
+			counter.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+};
+
+template<typename site_t = void>
+curry_counts curry_stats() noexcept
+{
+	using counters_t = instrumentation_counters<site_t>;
+	return curry_counts{counters_t::saturations.load(std::memory_order_relaxed), counters_t::partial_applications.load(std::memory_order_relaxed),
+		counters_t::bound_arguments.load(std::memory_order_relaxed),
+		counters_t::callable_copies.load(std::memory_order_relaxed), counters_t::callable_moves.load(std::memory_order_relaxed),
+		counters_t::argument_copies.load(std::memory_order_relaxed), counters_t::argument_moves.load(std::memory_order_relaxed)};
+}
+
+template<typename site_t = void>
+void reset_curry_stats() noexcept
+{
+	using counters_t = instrumentation_counters<site_t>;
+	for(std::atomic<std::size_t>* counter : {&counters_t::saturations, &counters_t::partial_applications, &counters_t::bound_arguments, &counters_t::callable_copies,
+		&counters_t::callable_moves, &counters_t::argument_copies, &counters_t::argument_moves})
+	{
+		counter->store(0, std::memory_order_relaxed);
+	}
+}
+
+//An argument of type t bound to an instrumented<..., site_t>, which counts being bound and every copy or move after that
+//The instrumented callable unwraps it again, so the wrapped callable is invoked with the t, just as without instrumentation
+template<typename t, typename site_t>
+class counted_argument
+{
+private:
+
+	using counters_t = instrumentation_counters<site_t>;
+
+	t value;
+
+public:
+
+	template<typename c_t>
+		requires (!std::is_same_v<std::remove_cvref_t<c_t>, counted_argument>)
+	constexpr counted_argument(c_t&& c) noexcept(std::is_nothrow_constructible_v<t, c_t>) : value(std::forward<c_t>(c))
+	{
+		counters_t::count(counters_t::bound_arguments);
+	}
+
+	constexpr counted_argument(counted_argument const& rhs) noexcept(std::is_nothrow_copy_constructible_v<t>) : value(rhs.value)
+	{
+		counters_t::count(counters_t::argument_copies);
+	}
+
+	constexpr counted_argument(counted_argument&& rhs) noexcept(std::is_nothrow_move_constructible_v<t>) : value(std::move(rhs.value))
+	{
+		counters_t::count(counters_t::argument_moves);
+	}
+
+	constexpr counted_argument& operator=(counted_argument const& rhs) noexcept(std::is_nothrow_copy_assignable_v<t>)
+	{
+		value = rhs.value;
+		counters_t::count(counters_t::argument_copies);
+		return *this;
+	}
+
+	constexpr counted_argument& operator=(counted_argument&& rhs) noexcept(std::is_nothrow_move_assignable_v<t>)
+	{
+		value = std::move(rhs.value);
+		counters_t::count(counters_t::argument_moves);
+		return *this;
+	}
+
+	constexpr ~counted_argument() = default;
+
+	constexpr t& get() & noexcept
+	{
+		return value;
+	}
+
+	constexpr t const& get() const& noexcept
+	{
+		return value;
+	}
+
+	constexpr t&& get() && noexcept
+	{
+		return std::move(value);
+	}
+
+	constexpr t const&& get() const&& noexcept
+	{
+		return std::move(value);
+	}
+};
+
+template<typename t>
+struct is_counted_argument : std::false_type {};
+
+template<typename t, typename site_t>
+struct is_counted_argument<counted_argument<t, site_t>> : std::true_type {};
+
+//Wraps callable_t without changing how it is invoked, but counts its invocations and its copies and moves under site_t
+//Arguments bound to it (or to its partial applications) are stored as counted_arguments, which are unwrapped before callable_t is invoked
+template<typename callable_t, typename site_t>
+class instrumented
+{
+private:
+
+	using counters_t = instrumentation_counters<site_t>;
+
+	CURRY_NO_UNIQUE_ADDRESS callable_t function;
+
+	//A counted_argument is passed on as the argument it holds, and anything else is passed on as it is
+	template<typename arg_t>
+	static constexpr decltype(auto) unwrap(arg_t&& arg) noexcept
+	{
+		if constexpr (is_counted_argument<std::remove_cvref_t<arg_t>>::value)
+		{
+			return std::forward<arg_t>(arg).get();
+		}
+		else
+		{
+			return std::forward<arg_t>(arg);
+		}
+	}
+
+	template<typename arg_t>
+	using unwrapped_t = decltype(unwrap(std::declval<arg_t>()));
+
+	template<typename self_t, typename...args_t>
+	static constexpr decltype(auto) invoke(self_t&& self, args_t&&...args)
+	{
+		counters_t::count(counters_t::saturations);
+		return std::invoke(std::forward<self_t>(self).function, unwrap(std::forward<args_t>(args))...);
+	}
+
+public:
+
+	constexpr explicit instrumented(callable_t function) noexcept(std::is_nothrow_move_constructible_v<callable_t>) : function(std::move(function)) {}
+
+	constexpr instrumented(instrumented const& rhs) noexcept(std::is_nothrow_copy_constructible_v<callable_t>) : function(rhs.function)
+	{
+		counters_t::count(counters_t::callable_copies);
+	}
+
+	constexpr instrumented(instrumented&& rhs) noexcept(std::is_nothrow_move_constructible_v<callable_t>) : function(std::move(rhs.function))
+	{
+		counters_t::count(counters_t::callable_moves);
+	}
+
+	constexpr instrumented& operator=(instrumented const& rhs) noexcept(std::is_nothrow_copy_assignable_v<callable_t>)
+	{
+		function = rhs.function;
+		counters_t::count(counters_t::callable_copies);
+		return *this;
+	}
+
+	constexpr instrumented& operator=(instrumented&& rhs) noexcept(std::is_nothrow_move_assignable_v<callable_t>)
+	{
+		function = std::move(rhs.function);
+		counters_t::count(counters_t::callable_moves);
+		return *this;
+	}
+
+	constexpr ~instrumented() = default;
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t&, unwrapped_t<args_t>...>
+	constexpr decltype(auto) operator()(args_t&&...args) & noexcept(curry<void>::is_nothrow_callable_v<callable_t&, unwrapped_t<args_t>...>)
+	{
+		return invoke(*this, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const&, unwrapped_t<args_t>...>
+	constexpr decltype(auto) operator()(args_t&&...args) const& noexcept(curry<void>::is_nothrow_callable_v<callable_t const&, unwrapped_t<args_t>...>)
+	{
+		return invoke(*this, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t, unwrapped_t<args_t>...>
+	constexpr decltype(auto) operator()(args_t&&...args) && noexcept(curry<void>::is_nothrow_callable_v<callable_t, unwrapped_t<args_t>...>)
+	{
+		return invoke(std::move(*this), std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const, unwrapped_t<args_t>...>
+	constexpr decltype(auto) operator()(args_t&&...args) const&& noexcept(curry<void>::is_nothrow_callable_v<callable_t const, unwrapped_t<args_t>...>)
+	{
+		return invoke(std::move(*this), std::forward<args_t>(args)...);
+	}
+};
+
+//Arguments are stored however callable_t would store them, wrapped up in a counted_argument
+template<typename callable_t, typename site_t>
+struct curry<void>::bound_argument<instrumented<callable_t, site_t>>
+{
+	template<typename arg_t>
+	using type = counted_argument<typename curry<void>::bound_argument<callable_t>::template type<arg_t>, site_t>;
+};
+
+//Counts every partial application of an instrumented constructed by curry, which copying or moving one afterwards doesn't
+template<typename callable_t, typename site_t>
+struct curry<void>::partial_application_hook<instrumented<callable_t, site_t>>
+{
+	static constexpr void created() noexcept
+	{
+		instrumentation_counters<site_t>::count(instrumentation_counters<site_t>::partial_applications);
+	}
+};
+
+//Applying arguments to an lvalue curry of an instrumented copies it exactly when it would copy callable_t, despite the counting copy constructor
+//Otherwise turning instrumentation on would bind a std::ref instead, so partial applications would start depending on the original's lifetime
+template<typename callable_t, typename site_t>
+constexpr bool curry<void>::copies_on_lvalue_application<instrumented<callable_t, site_t>> = curry<void>::copies_on_lvalue_application<callable_t>;
+
+//instrumented<callable_t, site_t> takes the same number of arguments as callable_t, so it gets the same single step splitting of arguments
+template<typename callable_t, typename site_t>
+	requires requires { curry<void>::known_arity<callable_t>::value; }
+struct curry<void>::known_arity<instrumented<callable_t, site_t>> : curry<void>::known_arity<callable_t> {};
+
+//The default for whether curry_instrumented counts anything, which differs between translation units built with and without CURRY_INSTRUMENTATION
+//Being constexpr, it has internal linkage, so those translation units each have their own rather than two definitions of one variable
+#ifdef CURRY_INSTRUMENTATION
+constexpr bool curry_instrumentation_default = true;
+#else
+constexpr bool curry_instrumentation_default = false;
+#endif
+
+//Returns a curry around f whose saturations, partial applications, copies and moves (and those of the arguments bound to it) are counted under site_t
+//The counts can be read with curry_stats<site_t>(), and a distinct site_t (such as a local tag struct) can be used for each call site
+//Unless enabled, this is just curry{f}, so instrumentation can be left in place and only turned on for some builds, by defining CURRY_INSTRUMENTATION
+//enabled is a template parameter, rather than the macro choosing between two bodies, so that translation units built with and without it instantiate different
+//specializations, instead of disagreeing about the definition (and return type) of the same one, which would violate the one definition rule
+//An inline function calling this with the default still has a different definition in each of those, so enabled should be passed explicitly in headers
+template<typename site_t = void, bool enabled = curry_instrumentation_default, typename callable_t>
+constexpr auto curry_instrumented(callable_t&& f)
+{
+	if constexpr (enabled)
+	{
+		return curry{instrumented<std::decay_t<callable_t>, site_t>{std::forward<callable_t>(f)}};
+	}
+	else
+	{
+		return curry{std::forward<callable_t>(f)};
+	}
+}
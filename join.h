@@ -0,0 +1,134 @@
+/*
+Overview of this file:
+
+join_node<ret_t(args_t...), callable_t>: a fixed set of argument slots for a callable, which can be filled from different threads in any order
+The result of the callable is discarded, but has to be convertible to ret_t (unless that is void), so that the signature documents it
+
+join_node::fill<i>: fills a slot, and invokes the callable with every slot if that was the last one missing
+
+curry_join<ret_t(args_t...)>(f): constructs a join_node for f
+*/
+
+
+#pragma once
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<optional>
+#include<tuple>
+#include<type_traits>
+#include<utility>
+#include "curry.h"
+
+
+template<typename signature_t, typename callable_t>
+class join_node;
+
+//A partial application whose arguments arrive concurrently: each argument has a slot, which may be filled by any thread, in any order
+//Which slots are filled is tracked by one atomic mask, and the thread filling the last one invokes the callable, without any lock or allocation
+//The slots are then emptied and the node can be filled again, where a slot filled early for the next round waits until this round has fired
+//Each slot should be filled by one thread per round, and the callable's result is discarded, so it should hand its result on by itself
+//Like the rest of curry, the arguments are decay-copied into the slots (following std::bind_front semantics) and moved out when fired
+//The callable may be an instance of curry, in which case the saturating application goes through it as usual
+template<typename ret_t, typename...args_t, typename callable_t>
+class join_node<ret_t(args_t...), callable_t>
+{
+public:
+
+	static constexpr std::size_t arity = sizeof...(args_t);
+
+	static_assert(arity > 0 && arity <= 64, "a join_node has between 1 and 64 slots");
+	static_assert(std::is_invocable_v<callable_t&, std::decay_t<args_t>...>, "the callable must be invocable with (rvalues of) every slot");
+	static_assert(std::is_invocable_r_v<ret_t, callable_t&, std::decay_t<args_t>...>, "the callable's result must be convertible to ret_t (unless ret_t is void), even though it is discarded");
+
+private:
+
+	using mask_t = std::uint64_t;
+
+	static constexpr mask_t full = arity == 64 ? ~mask_t(0) : (mask_t(1) << arity) - 1;
+
+	CURRY_NO_UNIQUE_ADDRESS callable_t function;
+	std::tuple<std::optional<std::decay_t<args_t>>...> slots;
+	std::atomic<mask_t> filled{0};
+
+	template<std::size_t...is>
+	void clear(std::index_sequence<is...>) noexcept
+	{
+		(std::get<is>(slots).reset(), ...);
+		filled.store(0, std::memory_order_release);
+		filled.notify_all();
+	}
+
+	//If the callable throws, the node is still emptied for the next round before the exception is passed on
+	template<std::size_t...is>
+	void fire(std::index_sequence<is...> indices)
+	{
+		try
+		{
+			std::invoke(function, std::move(*std::get<is>(slots))...);
+		}
+		catch(...)
+		{
+			clear(indices);
+			throw;
+		}
+		clear(indices);
+	}
+
+public:
+
+	explicit join_node(callable_t function) noexcept(std::is_nothrow_move_constructible_v<callable_t>) : function(std::move(function)) {}
+
+	join_node(join_node const&) = delete;
+	join_node& operator=(join_node const&) = delete;
+
+	//Fills slot i, returning whether it was the last slot missing, in which case the callable has been invoked by this call
+	template<std::size_t i, typename arg_t>
+		requires (i < arity) && std::is_constructible_v<std::tuple_element_t<i, std::tuple<std::decay_t<args_t>...>>, arg_t>
+	bool fill(arg_t&& arg)
+	{
+		constexpr mask_t bit = mask_t(1) << i;
+
+		//Only the case where this slot is still held by a round that hasn't finished firing
+		for(mask_t current = filled.load(std::memory_order_acquire); (current & bit) != 0; current = filled.load(std::memory_order_acquire))
+		{
+			filled.wait(current, std::memory_order_acquire);
+		}
+
+		std::get<i>(slots).emplace(std::forward<arg_t>(arg));
+
+		//acq_rel so that whichever thread completes the mask sees every slot written by the others
+		if((filled.fetch_or(bit, std::memory_order_acq_rel) | bit) == full)
+		{
+			fire(std::index_sequence_for<args_t...>{});
+			return true;
+		}
+		return false;
+	}
+
+	//The slots currently filled, as a mask with bit i set for slot i, which is only a snapshot when other threads are filling slots
+	mask_t filled_mask() const noexcept
+	{
+		return filled.load(std::memory_order_acquire);
+	}
+
+	callable_t& callable() noexcept
+	{
+		return function;
+	}
+
+	callable_t const& callable() const noexcept
+	{
+		return function;
+	}
+};
+
+//Constructs a join_node for f, with one slot for each argument in the signature given
+//Since a join_node can't be moved, this relies on guaranteed copy elision, as in auto node = curry_join<void(int, std::string)>(f);
+template<typename signature_t, typename callable_t>
+	requires std::is_function_v<signature_t>
+join_node<signature_t, std::decay_t<callable_t>> curry_join(callable_t&& f)
+{
+	return join_node<signature_t, std::decay_t<callable_t>>{std::forward<callable_t>(f)};
+}
@@ -0,0 +1,223 @@
+/*
+Overview of this file:
+
+lazy(f): returns a curry around f whose saturating applications return an unevaluated lazy_thunk instead of invoking f
+
+lazy_function<callable_t>: the callable wrapped by lazy, which binds its arguments into a lazy_thunk
+
+lazy_thunk<pending_t>: a saturated application which is evaluated (once) when it is forced, and caches its result
+
+force: forces the lazy_thunk wrapped up by a curry, returning a reference to its result
+*/
+
+
+#pragma once
+#include<functional>
+#include<type_traits>
+#include<utility>
+#include<variant>
+#include "curry.h"
+
+
+//A saturated application of a callable to its bound arguments, which is only evaluated the first time its result is asked for
+//That happens on a call to force() or on an implicit conversion to (a reference to) the result type, and the result is then kept
+//The bound arguments are moved into the call and destroyed along with the callable, so only the result is held afterwards
+//Copies of an unforced thunk are evaluated independently of each other, and forcing is not safe to do from multiple threads at once
+//If the result is itself callable, the thunk can be called (and thus applied further through curry) which forces it first
+//If evaluation throws, the thunk is left holding moved-from arguments and should not be forced again
+template<typename pending_t>
+class lazy_thunk
+{
+public:
+
+	using result_type = std::invoke_result_t<pending_t&&>;
+
+	//The type that forcing gives a reference to, which is result_type for lvalue references, or otherwise std::monostate for void
+	using value_type = std::conditional_t<std::is_void_v<result_type>, std::monostate,
+		std::conditional_t<std::is_lvalue_reference_v<result_type>, result_type, std::remove_cvref_t<result_type>>>;
+
+private:
+
+	using stored_t = std::conditional_t<std::is_lvalue_reference_v<result_type>, std::reference_wrapper<std::remove_reference_t<result_type>>, value_type>;
+
+	//mutable because forcing is logically const, it only ever replaces the pending application by its own result
+	mutable std::variant<pending_t, stored_t> state;
+
+	value_type& evaluate() const
+	{
+		if(state.index() == 0)
+		{
+			if constexpr (std::is_void_v<result_type>)
+			{
+				std::invoke(std::get<0>(std::move(state)));
+				state.template emplace<1>();
+			}
+			else
+			{
+				//The result is materialized before the pending application is destroyed by emplace
+				stored_t result(std::invoke(std::get<0>(std::move(state))));
+				state.template emplace<1>(std::move(result));
+			}
+		}
+		return std::get<1>(state);
+	}
+
+public:
+
+	explicit lazy_thunk(pending_t pending) noexcept(std::is_nothrow_move_constructible_v<pending_t>) :
+		state(std::in_place_index<0>, std::move(pending)) {}
+
+	bool is_forced() const noexcept
+	{
+		return state.index() == 1;
+	}
+
+	//Evaluates the application if that hasn't happened yet, returning its result (or nothing if it returns void)
+	decltype(auto) force() &
+	{
+		if constexpr (std::is_void_v<result_type>)
+		{
+			evaluate();
+		}
+		else
+		{
+			return evaluate();
+		}
+	}
+
+	decltype(auto) force() const&
+	{
+		if constexpr (std::is_void_v<result_type>)
+		{
+			evaluate();
+		}
+		else
+		{
+			return static_cast<value_type const&>(evaluate());
+		}
+	}
+
+	decltype(auto) force() &&
+	{
+		if constexpr (std::is_void_v<result_type>)
+		{
+			evaluate();
+		}
+		else
+		{
+			return static_cast<value_type&&>(evaluate());
+		}
+	}
+
+	operator value_type&() &
+	{
+		return evaluate();
+	}
+
+	operator value_type const&() const&
+	{
+		return evaluate();
+	}
+
+	operator value_type&&() &&
+	{
+		return static_cast<value_type&&>(evaluate());
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<value_type&, args_t...>
+	decltype(auto) operator()(args_t&&...args) &
+	{
+		return std::invoke(evaluate(), std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<value_type const&, args_t...>
+	decltype(auto) operator()(args_t&&...args) const&
+	{
+		return std::invoke(static_cast<value_type const&>(evaluate()), std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<value_type, args_t...>
+	decltype(auto) operator()(args_t&&...args) &&
+	{
+		return std::invoke(static_cast<value_type&&>(evaluate()), std::forward<args_t>(args)...);
+	}
+};
+
+//Wraps callable_t so that invoking it binds the arguments into a lazy_thunk rather than evaluating anything
+//It is invocable with exactly the arguments callable_t is, so curry still finds the same saturation points
+//The arguments are decay-copied into the thunk, following std::bind_front semantics like the rest of curry
+template<typename callable_t>
+class lazy_function
+{
+private:
+
+	CURRY_NO_UNIQUE_ADDRESS callable_t function;
+
+	template<typename self_t, typename...args_t>
+	static auto defer(self_t&& self, args_t&&...args)
+	{
+		auto pending = curry<void>::partially_apply(std::forward<self_t>(self).function, std::forward<args_t>(args)...);
+		return lazy_thunk<decltype(pending)>{std::move(pending)};
+	}
+
+public:
+
+	constexpr explicit lazy_function(callable_t function) noexcept(std::is_nothrow_move_constructible_v<callable_t>) : function(std::move(function)) {}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t&, args_t...>
+	auto operator()(args_t&&...args) &
+	{
+		return defer(*this, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const&, args_t...>
+	auto operator()(args_t&&...args) const&
+	{
+		return defer(*this, std::forward<args_t>(args)...);
+	}
+
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t, args_t...>
+	auto operator()(args_t&&...args) &&
+	{
+		return defer(std::move(*this), std::forward<args_t>(args)...);
+	}
+};
+
+//lazy_function<callable_t> takes the same number of arguments as callable_t, so it gets the same single step splitting of arguments
+template<typename callable_t>
+	requires requires { curry<void>::known_arity<callable_t>::value; }
+struct curry<void>::known_arity<lazy_function<callable_t>> : curry<void>::known_arity<callable_t> {};
+
+//Wraps f so that saturating it returns a curry<lazy_thunk<...>>, which holds the callable and its arguments but doesn't invoke anything
+//The result is computed on the first force(...), or the first implicit conversion of the thunk (for example of uncurry(...))
+//This way, speculative applications that are never looked at cost no more than storing their arguments
+template<typename callable_t>
+constexpr auto lazy(callable_t&& f)
+{
+	return curry{lazy_function<std::decay_t<callable_t>>{std::forward<callable_t>(f)}};
+}
+
+//Forces the thunk wrapped up by a curry, as returned by saturating a lazy(f), returning a reference to the result
+template<typename pending_t>
+decltype(auto) force(curry<lazy_thunk<pending_t>>& thunk)
+{
+	return static_cast<lazy_thunk<pending_t>&>(thunk).force();
+}
+
+template<typename pending_t>
+decltype(auto) force(curry<lazy_thunk<pending_t>> const& thunk)
+{
+	return static_cast<lazy_thunk<pending_t> const&>(thunk).force();
+}
+
+template<typename pending_t>
+decltype(auto) force(curry<lazy_thunk<pending_t>>&& thunk)
+{
+	return static_cast<lazy_thunk<pending_t>&&>(std::move(thunk)).force();
+}
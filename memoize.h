@@ -0,0 +1,292 @@
+/*
+Overview of this file:
+
+memoize(f, cache_args...): returns a curry around a memoized f, which caches the saturated results of f keyed on all of its arguments
+Only saturated calls are cached: partial applications like memoize(f)(a) are built anew every time, and share the cache rather than being held in it
+
+memoized<ret_t(args_t...), callable_t, cache_t>: the callable wrapped by memoize, whose copies (like the ones bound into partial applications) share one cache
+
+unordered_cache, lru_cache, sharded_cache: the caches which can be plugged into memoize, as well as memoize_hash which they use to hash the arguments
+
+memoize_signature: the trait memoize uses to read the signature of f, when it isn't given explicitly
+*/
+
+
+#pragma once
+#include<cstddef>
+#include<functional>
+#include<list>
+#include<memory>
+#include<mutex>
+#include<tuple>
+#include<type_traits>
+#include<unordered_map>
+#include<utility>
+#include "curry.h"
+
+
+//Hashes a tuple of arguments by combining the std::hash of each element
+struct memoize_hash
+{
+	template<typename...ts>
+	std::size_t operator()(std::tuple<ts...> const& key) const
+	{
+		return std::apply([](ts const&...elements)
+			{
+				std::size_t seed = 0;
+				((seed ^= std::hash<ts>{}(elements) + 0x9e3779b9 + (seed << 6) + (seed >> 2)), ...);
+				return seed;
+			}, key);
+	}
+};
+
+//A cache which never forgets, for use from one thread at a time
+template<typename key_t, typename value_t>
+class unordered_cache
+{
+private:
+
+	std::unordered_map<key_t, value_t, memoize_hash> results;
+
+public:
+
+	template<typename compute_t>
+	value_t get_or_compute(key_t&& key, compute_t&& compute)
+	{
+		if(auto found = results.find(key); found != results.end())
+		{
+			return found->second;
+		}
+		//compute isn't called while an iterator is held, so it may recursively use this cache
+		value_t value = std::forward<compute_t>(compute)(std::as_const(key));
+		return results.try_emplace(std::move(key), std::move(value)).first->second;
+	}
+
+	std::size_t size() const noexcept
+	{
+		return results.size();
+	}
+
+	void clear() noexcept
+	{
+		results.clear();
+	}
+};
+
+//A cache holding at most capacity results, evicting the least recently used one when full, for use from one thread at a time
+template<typename key_t, typename value_t>
+class lru_cache
+{
+private:
+
+	using entry_t = std::pair<key_t, value_t>;
+
+	std::size_t capacity;
+	std::list<entry_t> entries; //the most recently used entry comes first
+	std::unordered_map<key_t, typename std::list<entry_t>::iterator, memoize_hash> positions;
+
+public:
+
+	explicit lru_cache(std::size_t capacity = 1024) : capacity(capacity) {}
+
+	template<typename compute_t>
+	value_t get_or_compute(key_t&& key, compute_t&& compute)
+	{
+		if(auto found = positions.find(key); found != positions.end())
+		{
+			entries.splice(entries.begin(), entries, found->second);
+			return found->second->second;
+		}
+
+		value_t value = std::forward<compute_t>(compute)(std::as_const(key));
+		if(capacity == 0 || positions.contains(key))
+		{
+			return value;
+		}
+		if(entries.size() == capacity)
+		{
+			positions.erase(entries.back().first);
+			entries.pop_back();
+		}
+		entries.emplace_front(key, std::move(value));
+		positions.emplace(std::move(key), entries.begin());
+		return entries.front().second;
+	}
+
+	std::size_t size() const noexcept
+	{
+		return entries.size();
+	}
+
+	void clear() noexcept
+	{
+		positions.clear();
+		entries.clear();
+	}
+};
+
+//A cache which can be used from multiple threads at once, split into shards which each have their own mutex
+//Results are computed without holding any lock, so two threads missing on the same key may both compute it, and the first one is kept
+template<typename key_t, typename value_t>
+class sharded_cache
+{
+private:
+
+	struct shard
+	{
+		mutable std::mutex lock;
+		std::unordered_map<key_t, value_t, memoize_hash> results;
+	};
+
+	std::size_t shard_count;
+	std::unique_ptr<shard[]> shards;
+
+	shard& shard_for(key_t const& key) const
+	{
+		return shards[memoize_hash{}(key) % shard_count];
+	}
+
+public:
+
+	explicit sharded_cache(std::size_t shard_count = 16) : shard_count(shard_count == 0 ? 1 : shard_count), shards(std::make_unique<shard[]>(this->shard_count)) {}
+
+	template<typename compute_t>
+	value_t get_or_compute(key_t&& key, compute_t&& compute)
+	{
+		shard& s = shard_for(key);
+		{
+			std::lock_guard guard(s.lock);
+			if(auto found = s.results.find(key); found != s.results.end())
+			{
+				return found->second;
+			}
+		}
+
+		value_t value = std::forward<compute_t>(compute)(std::as_const(key));
+		std::lock_guard guard(s.lock);
+		return s.results.try_emplace(std::move(key), std::move(value)).first->second;
+	}
+
+	std::size_t size() const
+	{
+		std::size_t total = 0;
+		for(std::size_t i = 0; i != shard_count; ++i)
+		{
+			std::lock_guard guard(shards[i].lock);
+			total += shards[i].results.size();
+		}
+		return total;
+	}
+
+	void clear()
+	{
+		for(std::size_t i = 0; i != shard_count; ++i)
+		{
+			std::lock_guard guard(shards[i].lock);
+			shards[i].results.clear();
+		}
+	}
+};
+
+//memoize_signature<callable_t>::type is the signature of callable_t, for function pointers and classes with a single non-template operator() const
+//Generic or overloaded callables have no such signature, and have to be given one explicitly, as in memoize<int(int,int)>(f)
+template<typename callable_t>
+struct memoize_signature
+{
+};
+
+template<typename ret_t, typename...args_t>
+struct memoize_signature<ret_t(*)(args_t...)>
+{
+	using type = ret_t(args_t...);
+};
+
+template<typename ret_t, typename...args_t>
+struct memoize_signature<ret_t(*)(args_t...) noexcept>
+{
+	using type = ret_t(args_t...);
+};
+
+template<typename ret_t, typename class_t, typename...args_t>
+struct memoize_signature<ret_t(class_t::*)(args_t...) const>
+{
+	using type = ret_t(args_t...);
+};
+
+template<typename ret_t, typename class_t, typename...args_t>
+struct memoize_signature<ret_t(class_t::*)(args_t...) const noexcept>
+{
+	using type = ret_t(args_t...);
+};
+
+template<typename callable_t>
+	requires std::is_class_v<callable_t> && requires { &callable_t::operator(); }
+struct memoize_signature<callable_t> : memoize_signature<decltype(&callable_t::operator())>
+{
+};
+
+template<typename callable_t>
+using memoize_signature_t = typename memoize_signature<callable_t>::type;
+
+template<typename signature_t, typename callable_t, template<typename, typename> typename cache_t>
+class memoized;
+
+//Invokes callable_t (as a const lvalue, since memoizing only makes sense for pure functions) on a miss of the cache
+//The arguments are decayed into a std::tuple serving as the key, and the function is invoked with the elements of that key
+//Copies share the same cache, so every partial application of the same memoize(f) benefits from the results of the others
+//The partial applications themselves aren't cached, since curry builds them before the callable is ever invoked, so only saturated calls reach the cache
+//Its single non-template operator() lets curry split the arguments at the right place without probing
+template<typename ret_t, typename...args_t, typename callable_t, template<typename, typename> typename cache_t>
+class memoized<ret_t(args_t...), callable_t, cache_t>
+{
+public:
+
+	using key_type = std::tuple<std::decay_t<args_t>...>;
+	using value_type = std::decay_t<ret_t>;
+	using cache_type = cache_t<key_type, value_type>;
+
+	static_assert(!std::is_void_v<ret_t>, "memoizing a function returning void is meaningless");
+
+private:
+
+	callable_t function;
+	std::shared_ptr<cache_type> results;
+
+public:
+
+	template<typename...cache_args_t>
+	explicit memoized(callable_t function, cache_args_t&&...cache_args) :
+		function(std::move(function)), results(std::make_shared<cache_type>(std::forward<cache_args_t>(cache_args)...))
+	{
+	}
+
+	value_type operator()(args_t...args) const
+	{
+		return results->get_or_compute(key_type(std::forward<args_t>(args)...), [this](key_type const& key)
+			{
+				return value_type(std::apply(function, key));
+			});
+	}
+
+	//The cache shared by all copies, for example to clear it or check its size
+	cache_type& cache() const noexcept
+	{
+		return *results;
+	}
+};
+
+//Deduces the signature of f, see memoize_signature
+template<template<typename, typename> typename cache_t = unordered_cache, typename callable_t, typename...cache_args_t>
+auto memoize(callable_t&& f, cache_args_t&&...cache_args)
+{
+	using stored_t = std::decay_t<callable_t>;
+	return curry{memoized<memoize_signature_t<stored_t>, stored_t, cache_t>(std::forward<callable_t>(f), std::forward<cache_args_t>(cache_args)...)};
+}
+
+template<typename signature_t, template<typename, typename> typename cache_t = unordered_cache, typename callable_t, typename...cache_args_t>
+	requires std::is_function_v<signature_t>
+auto memoize(callable_t&& f, cache_args_t&&...cache_args)
+{
+	using stored_t = std::decay_t<callable_t>;
+	return curry{memoized<signature_t, stored_t, cache_t>(std::forward<callable_t>(f), std::forward<cache_args_t>(cache_args)...)};
+}
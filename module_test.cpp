@@ -0,0 +1,23 @@
+/*
+Checks that the currying module can be imported in place of currying.h, and that what it exports behaves like the headers
+Exits with a nonzero status if anything fails, so it can be run as an automated test
+*/
+
+#include<tuple>
+import currying;
+
+
+constexpr auto digits = [](int a, int b, int c) { return a * 100 + b * 10 + c; };
+
+static_assert(curried<decltype(curry{digits}), int, int, int, int>);
+static_assert(is_curried_v<decltype(curry{digits}(1))>);
+static_assert(curry{digits}(curry_placeholders::_, 2)(1, 3) == 123);
+
+int main()
+{
+	auto partial = curry{digits}(1);
+	int const one_at_a_time = uncurry(partial(2)(3));
+	int const applied = curry_apply(curry{digits}, std::tuple{4, 5, 6});
+
+	return one_at_a_time == 123 && applied == 456 ? 0 : 1;
+}
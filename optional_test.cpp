@@ -0,0 +1,507 @@
+/*
+Checks the behaviour of the optional headers, which currying.h doesn't include
+Like test.cpp, it checks what it can with static_asserts, and only runs what has to run, such as threads and shared state
+Exits with a nonzero status if any of that fails, so it can be run as an automated test
+*/
+
+#include<array>
+#include<atomic>
+#include<cstddef>
+#include<execution>
+#include<iostream>
+#include<stdexcept>
+#include<string>
+#include<thread>
+#include<type_traits>
+#include<utility>
+#include<vector>
+#include"currying.h"
+#include"curried_function.h"
+#include"batch.h"
+#include"memoize.h"
+#include"lazy.h"
+#include"async.h"
+#include"join.h"
+#include"scheduler.h"
+#include"capture.h"
+#include"constant.h"
+#include"compose.h"
+#include"instrument.h"
+#include"share.h"
+#include"dispatch.h"
+
+
+constexpr int digits(int a, int b, int c)
+{
+	return a * 100 + b * 10 + c;
+}
+
+//curried_function has a known signature, so curry splits the arguments it is applied to in one step
+static_assert(curried<curry<curried_function<int(int, int, int)>>, int, int, int, int>);
+static_assert(!std::is_constructible_v<curried_function<int(int)>, int(*)(int, int)>);
+
+//It stores partial applications, its copies are independent of each other, and callables too big for its buffer are only allocated when that is allowed
+bool curried_function_stores_callables()
+{
+	using function_t = curried_function<int(int)>;
+
+	function_t bound = curry{&digits}(1, 2);
+	function_t copy = bound;
+	bound = [](int c) { return c; };
+	function_t moved = std::move(copy);
+
+	std::array<char, 64> big{};
+	big[0] = 3;
+	curried_function<int(int), 3 * sizeof(void*), true> allocated = [big](int c) { return big[0] + c; };
+	auto allocated_copy = allocated;
+
+	return !function_t{} && bound(4) == 4 && moved(3) == 123 && int(curry{std::move(moved)}(5)) == 125 && allocated(1) == 4 && allocated_copy(2) == 5;
+}
+
+//curry_batch is out[i] = f(ins[i]...) up to the end of the shortest input, as a plain loop which can be evaluated at compile time too
+static_assert([]
+{
+	std::array<int, 4> out{-1, -1, -1, -1};
+	auto const end = curry_batch(curry{&digits}(9), out, std::array{1, 2, 3, 4}, std::array{5, 6, 7});
+	return end == out.begin() + 3 && out == std::array{915, 926, 937, -1};
+}());
+
+//batch_index_iterator is a random access iterator, which returns indices by value so that dereferencing a temporary one doesn't dangle
+static_assert(std::random_access_iterator<batch_index_iterator>);
+static_assert(*(batch_index_iterator{2} + 3) == 5 && batch_index_iterator{2}[1] == 3);
+
+//With an execution policy, the same loop is run by std::for_each on other threads
+bool curry_batch_runs_in_parallel()
+{
+	std::vector<int> const as{1, 2, 3, 4};
+	std::vector<int> out(as.size());
+	curry_batch(std::execution::par, curry{[](int a) { return a * a; }}, out, as);
+	return out == std::vector<int>{1, 4, 9, 16};
+}
+
+//An output range shorter than the inputs throws std::length_error before anything is written to it, with or without an execution policy
+bool curry_batch_rejects_short_outputs()
+{
+	std::vector<int> const as{1, 2, 3, 4};
+	std::vector<int> out(3, -1);
+	int throws = 0;
+	try
+	{
+		curry_batch(curry{[](int a) { return a * a; }}, out, as);
+	}
+	catch(std::length_error const&)
+	{
+		++throws;
+	}
+	try
+	{
+		curry_batch(std::execution::par, curry{[](int a) { return a * a; }}, out, as);
+	}
+	catch(std::length_error const&)
+	{
+		++throws;
+	}
+	return throws == 2 && out == std::vector<int>(3, -1);
+}
+
+//memoize reads the signature of f from its type, or takes it explicitly for generic callables, so its result is curried like f
+static_assert(std::is_same_v<memoize_signature_t<int(*)(int, int, int)>, int(int, int, int)>);
+static_assert(curried<decltype(memoize(&digits)), int, int, int, int>);
+static_assert(curried<decltype(memoize<int(int, int)>([](auto a, auto b) { return a - b; })), int, int, int>);
+
+int digits_calls = 0;
+
+int counted_digits(int a, int b, int c)
+{
+	++digits_calls;
+	return digits(a, b, c);
+}
+
+//Each result is computed once, partial applications of one memoize(f) share its cache, and lru_cache evicts the least recently used result
+bool memoize_computes_each_result_once()
+{
+	digits_calls = 0;
+	auto f = memoize(&counted_digits);
+	bool const is_cached = f(1, 2, 3) == 123 && f(1)(2)(3) == 123 && f(1, 2)(4) == 124 && digits_calls == 2 && uncurry(f).cache().size() == 2;
+
+	digits_calls = 0;
+	auto lru = memoize<lru_cache>(&counted_digits, 2);
+	for(int a : {1, 2, 1, 3, 1, 2})
+	{
+		lru(a, a, a);
+	}
+	bool const is_evicted = digits_calls == 4 && uncurry(lru).cache().size() == 2;
+
+	return is_cached && is_evicted;
+}
+
+//Saturating a lazy(f) returns a curry around a lazy_thunk, which forcing turns into (a reference to) the result
+static_assert(std::is_same_v<decltype(force(std::declval<decltype(lazy(&digits)(1, 2, 3))&>())), int&>);
+
+//It is evaluated once, when it is first forced, converted or called, and never if it isn't
+bool lazy_evaluates_once()
+{
+	int evaluations = 0;
+	auto f = lazy([&evaluations](int a, int b, int c) { ++evaluations; return digits(a, b, c); });
+
+	auto thunk = f(1)(2, 3);
+	auto unforced = f(4, 5, 6);
+	bool const is_deferred = evaluations == 0 && !uncurry(thunk).is_forced();
+	bool const is_forced_once = force(thunk) == 123 && force(thunk) == 123 && evaluations == 1 && uncurry(thunk).is_forced();
+
+	int const converted = uncurry(f(7, 8, 9));
+	auto nested = lazy([](int a) { return [a](int b) { return a - b; }; });
+
+	(void)unforced;
+	return is_deferred && is_forced_once && converted == 789 && evaluations == 2 && int(nested(5)(3)) == 2;
+}
+
+//Saturating a curry_async(executor, f) returns a curry around an async_result, rather than the result itself
+static_assert(std::is_same_v<decltype(curry_async(inline_executor{}, &digits)(1, 2, 3)), curry<async_result<int>>>);
+
+//The results (or exceptions) of applications run on the executor come back through get(), whichever thread they ran on
+bool curry_async_returns_results()
+{
+	auto inline_result = uncurry(curry_async(inline_executor{}, &digits)(1)(2)(3));
+	bool const is_inline = inline_result.ready() && inline_result.get() == 123;
+
+	auto threaded = curry_async(thread_executor{}, &digits)(4, 5);
+	auto first = uncurry(threaded(6));
+	auto second = uncurry(threaded(7));
+	bool const is_threaded = first.get() == 456 && second.get() == 457;
+
+	auto throwing = uncurry(curry_async(thread_executor{}, [](int a) -> int { throw std::runtime_error(std::to_string(a)); })(9));
+	bool is_rethrown = false;
+	try
+	{
+		throwing.get();
+	}
+	catch(std::runtime_error const& error)
+	{
+		is_rethrown = std::string(error.what()) == "9";
+	}
+
+	return is_inline && is_threaded && is_rethrown;
+}
+
+//A join_node has a slot for each argument of its signature, can't be copied since its slots are filled in place, and takes callables whose result converts to the return type
+static_assert(join_node<void(int, int, int), void(*)(int, int, int)>::arity == 3);
+static_assert(!std::is_copy_constructible_v<join_node<void(int), void(*)(int)>>);
+static_assert(join_node<long(int), int(*)(int)>::arity == 1);
+
+//It fires once the last slot is filled, in any order and from any thread, and then starts over
+bool curry_join_fires_once_per_round()
+{
+	int result = 0;
+	auto node = curry_join<void(int, int, int)>([&result](int a, int b, int c) { result = digits(a, b, c); });
+	bool const fired_first = node.fill<2>(3);
+	bool const fired_second = node.fill<0>(1);
+	bool const fired_last = node.fill<1>(2);
+	bool const is_joined = !fired_first && !fired_second && fired_last && result == 123 && node.filled_mask() == 0;
+
+	node.fill<0>(4);
+	node.fill<1>(5);
+	node.fill<2>(6);
+	bool const is_refilled = result == 456;
+
+	std::atomic<int> rounds = 0;
+	std::atomic<int> sum = 0;
+	auto threaded = curry_join<void(int, int)>(curry{[&](int a, int b) { ++rounds; sum += a * b; }});
+	{
+		std::jthread left([&] { for(int i = 1; i <= 100; ++i) threaded.fill<0>(i); });
+		std::jthread right([&] { for(int i = 1; i <= 100; ++i) threaded.fill<1>(2); });
+	}
+
+	return is_joined && is_refilled && rounds == 100 && sum == 2 * 5050;
+}
+
+//Tasks are stored inline in a curried_function, so submitting one never allocates
+static_assert(std::is_same_v<curry_scheduler<>::task_type, curried_function<void(), 4 * sizeof(void*)>>);
+
+//Every task submitted has run by the time the scheduler is destroyed, including tasks submitted by tasks and ones run inline because a queue was full
+bool curry_scheduler_runs_every_task()
+{
+	std::array<std::atomic<int>, 64> results{};
+	auto store = [&results](std::size_t i, int a, int b, int c) { return [&results, i, a, b, c] { results[i] = digits(a, b, c); }; };
+	{
+		curry_scheduler<> scheduler(4);
+		for(std::size_t i = 0; i != results.size(); ++i)
+		{
+			scheduler.submit(curry{store}(i, 1, 2, int(i % 10)));
+		}
+	}
+	bool all_ran = true;
+	for(std::size_t i = 0; i != results.size(); ++i)
+	{
+		all_ran = all_ran && results[i] == 120 + int(i % 10);
+	}
+
+	std::atomic<int> count = 0;
+	{
+		curry_scheduler<> scheduler(2, 2);
+		for(int i = 0; i != 100; ++i)
+		{
+			scheduler.submit([&scheduler, &count]
+				{
+					scheduler.submit([&count] { ++count; });
+					++count;
+				});
+		}
+	}
+
+	return all_ran && count == 200;
+}
+
+//curry_by_reference binds big or non-trivially-copyable lvalues by reference, and small trivially copyable ones and all rvalues by copy
+struct wide
+{
+	int values[8];
+};
+
+constexpr auto first_plus = [](wide const& w, int a, int b) { return w.values[0] + a + b; };
+
+static_assert(is_captured_by_reference_v<wide&, 2 * sizeof(void*)> && !is_captured_by_reference_v<int&, 2 * sizeof(void*)> && !is_captured_by_reference_v<wide&&, 2 * sizeof(void*)>);
+static_assert(sizeof(curry_by_reference(first_plus)(std::declval<wide&>())) == sizeof(wide*));
+static_assert([]
+{
+	wide w{{1}};
+	int a = 10;
+	auto bound = curry_by_reference(first_plus)(w, a);
+	w.values[0] = 2;
+	a = 20;
+	return bound(100) == 112;
+}());
+
+//Up to max_copy_size, trivially copyable lvalues are still copied
+static_assert([]
+{
+	wide w{{1}};
+	auto copied = curry_by_reference<sizeof(wide)>(first_plus)(w);
+	w.values[0] = 2;
+	return copied(10, 100) == 111;
+}());
+
+//bind_constants binds template parameters, so binding them to a stateless callable leaves it empty, and binding more appends to the same constant_application
+constexpr auto stateless_digits = [](int a, int b, int c) { return digits(a, b, c); };
+using stateless_digits_t = std::remove_const_t<decltype(stateless_digits)>;
+
+static_assert(std::is_empty_v<decltype(bind_constants<1>(stateless_digits))>);
+static_assert(bind_constants<1>(stateless_digits)(2)(3) == 123 && bind_constants<1>(stateless_digits)(4, 5) == 145);
+static_assert(std::is_same_v<decltype(bind_constants<2>(bind_constants<1>(stateless_digits))), curry<constant_application<stateless_digits_t, 1, 2>>>);
+
+//Like curry{f}(values...), binding every argument as a constant invokes f right away
+static_assert(bind_constants<1, 2, 3>(stateless_digits) == 123 && bind_constants<3>(bind_constants<1, 2>(stateless_digits)) == 123);
+
+//Constants beyond those are bound to the result, just as curry{f}(values...) applies them to it
+constexpr auto digits_one_at_a_time = [](int a) { return [a](int b, int c) { return digits(a, b, c); }; };
+static_assert(bind_constants<1, 2>(digits_one_at_a_time)(3) == 123 && bind_constants<1, 2, 3>(digits_one_at_a_time) == 123);
+
+//f | g | h builds a single composition of all three stages, which is empty if they are stateless, and applies them in order
+constexpr curry add{[](int a, int b) { return a + b; }};
+constexpr curry twice{[](int a) { return a * 2; }};
+constexpr curry negate{[](int a) { return -a; }};
+
+static_assert(std::is_same_v<decltype(add | twice | negate), curry<composition<std::remove_cvref_t<decltype(uncurry(add))>,
+	std::remove_cvref_t<decltype(uncurry(twice))>, std::remove_cvref_t<decltype(uncurry(negate))>>>>);
+static_assert(std::is_empty_v<decltype(add | twice | negate)>);
+static_assert((add | twice | negate)(1, 2) == -6 && (add | twice | negate)(3)(4) == -14);
+
+//Stateful stages are held in the composition
+static_assert([]
+{
+	int offset = 10;
+	return compose([offset](int a) { return a + offset; }, twice)(1) == 22;
+}());
+
+//curry_instrumented<site_t, true> counts what each site does in static counters, whether or not CURRY_INSTRUMENTATION is defined, and curry_instrumented<site_t, false> is just curry
+struct instrumented_site {};
+
+static_assert(std::is_same_v<decltype(curry_instrumented<instrumented_site, false>(&digits)), decltype(curry{&digits})>);
+static_assert(!std::is_same_v<decltype(curry_instrumented<instrumented_site, true>(&digits)), decltype(curry{&digits})>);
+static_assert(std::is_same_v<decltype(curry_instrumented<instrumented_site>(&digits)), decltype(curry{&digits})>); //since CURRY_INSTRUMENTATION isn't defined here
+
+bool counts_are(curry_counts const& counts, std::size_t saturations, std::size_t partial_applications, std::size_t bound_arguments,
+	std::size_t callable_copies, std::size_t callable_moves, std::size_t argument_copies, std::size_t argument_moves)
+{
+	return counts.saturations == saturations && counts.partial_applications == partial_applications && counts.bound_arguments == bound_arguments &&
+		counts.callable_copies == callable_copies && counts.callable_moves == callable_moves &&
+		counts.argument_copies == argument_copies && counts.argument_moves == argument_moves;
+}
+
+//Binding to an lvalue curry copies its callable into a new partial application, and binding to that only adds arguments
+//Copying and moving a partial application counts its arguments, but isn't a new partial application
+bool curry_instrumented_counts()
+{
+	auto f = curry_instrumented<instrumented_site, true>(&digits);
+	reset_curry_stats<instrumented_site>();
+
+	auto bound_one = f(1);
+	bool const is_bound_once = counts_are(curry_stats<instrumented_site>(), 0, 1, 1, 1, 1, 0, 0);
+	auto bound_two = bound_one(2);
+	bool const is_bound_twice = counts_are(curry_stats<instrumented_site>(), 0, 2, 2, 1, 1, 0, 0);
+
+	auto copied = bound_two;
+	auto moved = std::move(copied);
+	bool const is_copied = counts_are(curry_stats<instrumented_site>(), 0, 2, 2, 1, 1, 1, 1);
+
+	int const saturated = moved(3);
+	int const at_once = f(4, 5, 6);
+	bool const is_saturated = saturated == 123 && at_once == 456 && counts_are(curry_stats<instrumented_site>(), 2, 2, 2, 2, 1, 1, 1);
+
+	reset_curry_stats<instrumented_site>();
+	return is_bound_once && is_bound_twice && is_copied && is_saturated && counts_are(curry_stats<instrumented_site>(), 0, 0, 0, 0, 0, 0, 0);
+}
+
+//Applying a local instrumented curry through an lvalue copies its callable just as curry does, so the result can outlive it
+auto instrumented_partial_of_stateful_lambda()
+{
+	auto f = curry_instrumented<instrumented_site, true>([k = 40](int x, int y) { return k + x + y; });
+	return f(1);
+}
+
+bool curry_instrumented_copies_like_curry()
+{
+	return int(instrumented_partial_of_stateful_lambda()(1)) == 42;
+}
+
+//curry_shared wraps what it shares in a shared_application, and sharing that again doesn't add another layer
+static_assert(std::is_same_v<decltype(curry_shared(curry_shared(&digits))), decltype(curry_shared(&digits))>);
+
+//Copies and partial applications all share one block, whose use_count follows them
+bool curry_shared_shares_one_block()
+{
+	auto shared = curry_shared(curry{&digits}(1));
+	bool const is_single = uncurry(shared).use_count() == 1;
+
+	auto bound = shared(2);
+	auto copy = shared;
+	bool const is_shared = uncurry(shared).use_count() == 3 && &uncurry(copy).get() == &uncurry(shared).get() && bound(3) == 123 && copy(4, 5) == 145;
+
+	auto reshared = curry_shared(copy);
+	{
+		auto dropped = shared;
+	}
+	bool const is_reused = &uncurry(reshared).get() == &uncurry(shared).get() && uncurry(shared).use_count() == 4;
+
+	return is_single && is_shared && is_reused;
+}
+
+//dispatch looks dense keys up in a jump table, and sparse ones through a perfect hash, invoking the handler for each key in a single step
+enum class operation { add, subtract, multiply };
+
+static_assert(dispatch_keys<operation::add, operation::subtract, operation::multiply>::is_dense);
+static_assert(!dispatch_keys<1, 1000, -70000, 1 << 30>::is_dense);
+
+constexpr auto calculate = dispatch<int(int, int), operation::add, operation::subtract, operation::multiply>(
+	[](int a, int b) { return a + b; }, [](int a, int b) { return a - b; }, curry{[](int a, int b) { return a * b; }});
+
+static_assert(std::is_empty_v<decltype(calculate)>);
+static_assert(calculate(operation::add, 2, 3) == 5 && calculate(operation::subtract)(2)(3) == -1 && calculate(operation::multiply, 2)(3) == 6);
+
+constexpr auto sparse = dispatch<int(int), 1, 1000, -70000, 1 << 30>(
+	[](int a) { return a + 1; }, [](int a) { return a + 1000; }, [](int a) { return a - 70000; }, [](int a) { return -a; });
+using sparse_table_t = std::remove_cvref_t<decltype(uncurry(sparse))>;
+
+static_assert(sparse(1, 0) == 1 && sparse(1000, 0) == 1000 && sparse(-70000, 0) == -70000 && sparse(1 << 30, 7) == -7);
+static_assert(sparse_table_t::contains(1000) && !sparse_table_t::contains(999) && !sparse_table_t::contains(2));
+
+//Keys that aren't in the table throw std::out_of_range, whether they miss the dense range or the key held in their slot
+bool dispatch_throws_for_missing_keys()
+{
+	bool dense_threw = false;
+	try
+	{
+		calculate(static_cast<operation>(7), 1, 2);
+	}
+	catch(std::out_of_range const&)
+	{
+		dense_threw = true;
+	}
+
+	bool sparse_threw = false;
+	try
+	{
+		sparse(2, 0);
+	}
+	catch(std::out_of_range const&)
+	{
+		sparse_threw = true;
+	}
+
+	return dense_threw && sparse_threw;
+}
+
+int main()
+{
+	if(!curried_function_stores_callables())
+	{
+		std::cout << "curried_function didn't store, copy or move its callable correctly\n";
+		return 1;
+	}
+
+	if(!curry_batch_runs_in_parallel())
+	{
+		std::cout << "curry_batch gave different results with a parallel execution policy\n";
+		return 1;
+	}
+
+	if(!curry_batch_rejects_short_outputs())
+	{
+		std::cout << "curry_batch didn't throw std::length_error for an output range shorter than its inputs\n";
+		return 1;
+	}
+
+	if(!memoize_computes_each_result_once())
+	{
+		std::cout << "memoize computed a result that it had cached, or didn't evict from an lru_cache\n";
+		return 1;
+	}
+
+	if(!lazy_evaluates_once())
+	{
+		std::cout << "lazy evaluated a thunk before it was forced, or more than once\n";
+		return 1;
+	}
+
+	if(!curry_async_returns_results())
+	{
+		std::cout << "curry_async lost a result or an exception\n";
+		return 1;
+	}
+
+	if(!curry_join_fires_once_per_round())
+	{
+		std::cout << "curry_join fired before all of its slots were filled, or more than once per round\n";
+		return 1;
+	}
+
+	if(!curry_scheduler_runs_every_task())
+	{
+		std::cout << "curry_scheduler lost a task\n";
+		return 1;
+	}
+
+	if(!curry_instrumented_counts())
+	{
+		std::cout << "curry_instrumented miscounted\n";
+		return 1;
+	}
+
+	if(!curry_instrumented_copies_like_curry())
+	{
+		std::cout << "curry_instrumented bound an lvalue callable by reference\n";
+		return 1;
+	}
+
+	if(!curry_shared_shares_one_block())
+	{
+		std::cout << "curry_shared didn't share its block, or miscounted its owners\n";
+		return 1;
+	}
+
+	if(!dispatch_throws_for_missing_keys())
+	{
+		std::cout << "dispatch didn't throw std::out_of_range for a missing key\n";
+		return 1;
+	}
+}
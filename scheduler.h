@@ -0,0 +1,228 @@
+/*
+Overview of this file:
+
+curry_scheduler<buffer_size>: a fixed pool of worker threads running nullary curried tasks, such as curry{f}(args...) waiting for its unit application
+
+curry_scheduler::submit: queues a task, storing it in an inline curried_function<void(), buffer_size> without allocating
+
+curry_scheduler::task_queue: the bounded per-worker deque, which its worker uses as a stack and other workers steal from the front of
+*/
+
+
+#pragma once
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<memory>
+#include<new>
+#include<thread>
+#include<type_traits>
+#include<utility>
+#include<vector>
+#include "curry.h"
+#include "curried_function.h"
+
+
+//Runs tasks, meaning anything invocable with no arguments (like a curry which only needs its unit application), on a pool of worker threads
+//Every worker has its own bounded deque of tasks: tasks submitted by a worker go to its own deque, which it runs newest first
+//Tasks submitted from other threads are spread over the deques, and a worker with nothing left to do steals the oldest task of another
+//Tasks are stored in curried_function<void(), buffer_size>, so submitting a task never allocates (and a task too big to fit is a compile error)
+//If the chosen deque is full, the task is run right away by the thread submitting it instead, so a flood of tasks slows its producer down
+//Tasks should not throw, since like with std::thread there is nowhere to report the exception to, and std::terminate is called
+//The destructor runs every task that has been submitted so far (including the ones they submit) before joining the workers
+template<std::size_t buffer_size = 4 * sizeof(void*)>
+class curry_scheduler
+{
+public:
+
+	using task_type = curried_function<void(), buffer_size>;
+
+	//A deque of at most a power of two tasks, which is guarded by a spinlock since it is only ever held for a single move of a task
+	//Each one is on its own cache line(s), so that workers running from their own queues don't contend with each other
+	class alignas(64) task_queue
+	{
+	private:
+
+		std::atomic_flag busy;
+		std::unique_ptr<task_type[]> ring;
+		std::size_t mask;
+		std::size_t head = 0; //the oldest task, which is stolen first
+		std::size_t tail = 0; //one past the newest task, which its own worker runs first
+
+		void lock() noexcept
+		{
+			while(busy.test_and_set(std::memory_order_acquire))
+			{
+				while(busy.test(std::memory_order_relaxed))
+				{
+				}
+			}
+		}
+
+		void unlock() noexcept
+		{
+			busy.clear(std::memory_order_release);
+		}
+
+	public:
+
+		explicit task_queue(std::size_t capacity) : ring(std::make_unique<task_type[]>(capacity)), mask(capacity - 1) {}
+
+		bool push(task_type&& task) noexcept
+		{
+			lock();
+			bool const pushed = tail - head <= mask;
+			if(pushed)
+			{
+				ring[tail++ & mask] = std::move(task);
+			}
+			unlock();
+			return pushed;
+		}
+
+		bool pop(task_type& task) noexcept
+		{
+			lock();
+			bool const popped = tail != head;
+			if(popped)
+			{
+				task = std::move(ring[--tail & mask]);
+			}
+			unlock();
+			return popped;
+		}
+
+		bool steal(task_type& task) noexcept
+		{
+			lock();
+			bool const stolen = tail != head;
+			if(stolen)
+			{
+				task = std::move(ring[head++ & mask]);
+			}
+			unlock();
+			return stolen;
+		}
+	};
+
+private:
+
+	std::vector<std::unique_ptr<task_queue>> queues;
+	std::vector<std::thread> workers;
+	std::atomic<std::uint32_t> epoch{0}; //bumped whenever a task is queued, and waited on by workers with nothing to do
+	std::atomic<std::size_t> next_queue{0};
+	std::atomic<bool> stopping{false};
+
+	//The queue of the worker running on this thread, if it is a worker of this scheduler
+	static inline thread_local curry_scheduler const* current_scheduler = nullptr;
+	static inline thread_local std::size_t current_index = 0;
+
+	static std::size_t round_up_to_power_of_two(std::size_t n) noexcept
+	{
+		std::size_t power = 1;
+		while(power < n)
+		{
+			power <<= 1;
+		}
+		return power;
+	}
+
+	bool find_task(std::size_t index, task_type& task) noexcept
+	{
+		if(queues[index]->pop(task))
+		{
+			return true;
+		}
+		for(std::size_t offset = 1; offset != queues.size(); ++offset)
+		{
+			if(queues[(index + offset) % queues.size()]->steal(task))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void work(std::size_t index) noexcept
+	{
+		current_scheduler = this;
+		current_index = index;
+
+		task_type task;
+		while(true)
+		{
+			std::uint32_t const seen = epoch.load(std::memory_order_acquire);
+			if(find_task(index, task))
+			{
+				task();
+				task = task_type{}; //releases whatever the task held right away, rather than when the next one comes along
+			}
+			else if(stopping.load(std::memory_order_acquire))
+			{
+				return;
+			}
+			else
+			{
+				epoch.wait(seen, std::memory_order_acquire);
+			}
+		}
+	}
+
+public:
+
+	//Starts workers_requested workers (or one, if that is 0), each with a deque holding up to queue_capacity (rounded up to a power of two) tasks
+	explicit curry_scheduler(std::size_t workers_requested = std::thread::hardware_concurrency(), std::size_t queue_capacity = 1024)
+	{
+		workers_requested = workers_requested == 0 ? 1 : workers_requested;
+		queue_capacity = round_up_to_power_of_two(queue_capacity == 0 ? 1 : queue_capacity);
+
+		queues.reserve(workers_requested);
+		for(std::size_t i = 0; i != workers_requested; ++i)
+		{
+			queues.push_back(std::make_unique<task_queue>(queue_capacity));
+		}
+
+		workers.reserve(workers_requested);
+		for(std::size_t i = 0; i != workers_requested; ++i)
+		{
+			workers.emplace_back([this, i] { work(i); });
+		}
+	}
+
+	curry_scheduler(curry_scheduler const&) = delete;
+	curry_scheduler& operator=(curry_scheduler const&) = delete;
+
+	~curry_scheduler()
+	{
+		stopping.store(true, std::memory_order_release);
+		epoch.fetch_add(1, std::memory_order_release);
+		epoch.notify_all();
+		for(std::thread& worker : workers)
+		{
+			worker.join();
+		}
+	}
+
+	//Queues task, which is stored by value in a task_type, onto the deque of the calling worker or else the next deque in turn
+	template<typename task_t>
+		requires std::is_invocable_v<std::decay_t<task_t>&>
+	void submit(task_t&& task)
+	{
+		std::size_t const index = current_scheduler == this ? current_index : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+		task_type stored(std::forward<task_t>(task));
+		if(!queues[index]->push(std::move(stored)))
+		{
+			stored();
+			return;
+		}
+
+		epoch.fetch_add(1, std::memory_order_release);
+		epoch.notify_one();
+	}
+
+	std::size_t worker_count() const noexcept
+	{
+		return workers.size();
+	}
+};
@@ -0,0 +1,95 @@
+/*
+Overview of this file:
+
+curry_shared(f): returns a curry around f which keeps f (along with any arguments already bound to it) in a single immutable, reference counted block
+
+shared_application<callable_t>: the callable wrapped by curry_shared, which invokes the shared callable_t as a const lvalue
+
+is_shared_application: whether a type is an instance of shared_application
+*/
+
+
+#pragma once
+#include<functional>
+#include<memory>
+#include<type_traits>
+#include<utility>
+#include "curry.h"
+#include "uncurry.h"
+
+
+//Holds a callable_t which can no longer be modified, shared by every copy through a std::shared_ptr
+//So copying it (or a partial application of it) costs an atomic increment, however many arguments are already bound to callable_t
+//callable_t is always invoked as a const lvalue, so invoking it from many threads at once is safe as long as its const operator() is
+//Arguments bound to it later are stored as usual, next to the shared_application, so only what was bound before sharing is shared
+template<typename callable_t>
+class shared_application
+{
+private:
+
+	std::shared_ptr<callable_t const> function;
+
+public:
+
+	explicit shared_application(std::shared_ptr<callable_t const> function) noexcept : function(std::move(function)) {}
+
+	//A single const operator(), since every copy invokes the same callable_t, whatever the qualifiers of the copy are
+	template<typename...args_t>
+		requires std::is_invocable_v<callable_t const&, args_t...>
+	decltype(auto) operator()(args_t&&...args) const noexcept(curry<void>::is_nothrow_callable_v<callable_t const&, args_t...>)
+	{
+		return std::invoke(*function, std::forward<args_t>(args)...);
+	}
+
+	//The shared callable, for example to check that it is what was expected
+	callable_t const& get() const noexcept
+	{
+		return *function;
+	}
+
+	long use_count() const noexcept
+	{
+		return function.use_count();
+	}
+};
+
+//Arguments bound to a shared_application are stored however callable_t would store them
+template<typename callable_t>
+struct curry<void>::bound_argument<shared_application<callable_t>> : curry<void>::bound_argument<callable_t> {};
+
+//shared_application<callable_t> takes the same number of arguments as callable_t, so it gets the same single step splitting of arguments
+template<typename callable_t>
+	requires requires { curry<void>::known_arity<callable_t>::value; }
+struct curry<void>::known_arity<shared_application<callable_t>> : curry<void>::known_arity<callable_t> {};
+
+//Applying arguments to an lvalue curry of a shared_application copies the handle, rather than binding a std::ref to it
+//All copies invoke the same const callable_t, so this can't behave any differently, and the partial application doesn't depend on the original's lifetime
+template<typename callable_t>
+constexpr bool curry<void>::copies_on_lvalue_application<shared_application<callable_t>> = true;
+
+template<typename t>
+struct is_shared_application : std::false_type {};
+
+template<typename callable_t>
+struct is_shared_application<shared_application<callable_t>> : std::true_type {};
+
+//Moves (or copies) f into a single immutable block shared by every copy of the result, so the result can be handed to many threads cheaply
+//f may be a callable or a curry, such as a heavily bound partial application, in which case the callable it wraps is what gets shared
+//If f is already shared, the result shares the same block
+template<typename callable_t>
+auto curry_shared(callable_t&& f)
+{
+	if constexpr (requires { typename uncurried<std::remove_cvref_t<callable_t>>::type; })
+	{
+		return curry_shared(uncurry(std::forward<callable_t>(f)));
+	}
+	else if constexpr (is_shared_application<std::remove_cvref_t<callable_t>>::value)
+	{
+		return curry{std::forward<callable_t>(f)};
+	}
+	else
+	{
+		using stored_t = std::decay_t<callable_t>;
+		return curry{shared_application<stored_t>{std::make_shared<stored_t const>(std::forward<callable_t>(f))}};
+	}
+}
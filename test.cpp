@@ -1,5 +1,76 @@
 #include<iostream>
-#include"curry.h"
+#include<memory>
+#include"currying.h"
+
+//Layout guarantees: curry adds no size, and partial applications pack their callable and bound arguments by alignment
+struct tag_a {};
+struct tag_b {};
+constexpr auto stateless = [](tag_a, tag_b, char a, double b, char c, int d) { return a + b + c + d; };
+static_assert(sizeof(curry{stateless}) == sizeof(stateless) && std::is_empty_v<decltype(curry{stateless})>);
+static_assert(std::is_empty_v<decltype(curry{stateless}(tag_a{}, tag_b{}))>);
+static_assert(sizeof(curry{stateless}(tag_a{}, tag_b{}, 'a', 1.0, 'c')) == 2 * sizeof(double)); //would be 3 * sizeof(double) if left in order
+
+//Applying a small trivially copyable callable through an lvalue copies it rather than binding a std::ref to it
+constexpr curry stateless_curry{stateless};
+static_assert(std::is_empty_v<decltype(stateless_curry(tag_a{}, tag_b{}))>);
+
+//This includes a const operator() changing mutable members, which changes the copy, unless the original is explicitly wrapped in std::ref
+//Checked in main, since mutable members can't be read in constant expressions
+struct counting_add
+{
+	mutable int calls = 0;
+	int operator()(int a, int b) const { ++calls; return a + b; }
+};
+
+//Signatures of callables with known arity are checked all at once, and agree with applying the arguments one at a time
+static_assert(curried<decltype(curry{stateless}), double, tag_a, tag_b, char, double, char, int>);
+static_assert(!curried<decltype(curry{stateless}), tag_a, tag_a, tag_b, char, double, char, int>);
+static_assert(curried<decltype(curry{stateless}(tag_a{})), double, tag_b, char, double, char, int>);
+
+//Checking them one argument at a time takes minutes at this arity, so this keeps compiling fast only while the single check is all that is instantiated
+constexpr auto sixteen = [](int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int) { return 16; };
+static_assert(curried<decltype(curry{sixteen}), int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int>);
+
+//Applying a tuple of arguments is the same as applying them all at once
+static_assert(double(curry_apply(stateless_curry, std::tuple{tag_a{}, tag_b{}, 'a', 1.0, 'c', 2})) == stateless(tag_a{}, tag_b{}, 'a', 1.0, 'c', 2));
+static_assert(std::is_empty_v<decltype(curry_apply(stateless_curry, std::tuple{tag_a{}, tag_b{}}))>);
+
+//Results are constructed directly inside of the curry wrapping them up, so they don't have to be movable
+struct pinned
+{
+	int value;
+	constexpr pinned(int value) : value(value) {}
+	pinned(pinned&&) = delete;
+};
+static_assert(static_cast<pinned const&>(curry{[](int a, int b) { return pinned{a + b}; }}(1)(2)).value == 3);
+
+//Placeholders leave arguments to be filled in later, and take up no space in the partial application
+constexpr auto digits = [](int a, int b, int c) { return a * 100 + b * 10 + c; };
+static_assert(curry{digits}(curry_placeholders::_, 2)(1, 3) == 123);
+static_assert(curry{digits}(curry_placeholders::_, 2, curry_placeholders::_)(curry_placeholders::_, 3)(1) == 123);
+static_assert(sizeof(curry{digits}(curry_placeholders::_, curry_placeholders::_, 3)) == sizeof(int));
+
+//Arguments that would have to be copied to be bound, but can't be, make the application ill formed rather than a hard error
+using takes_unique_t = curry<int(*)(std::unique_ptr<int>, int)>;
+static_assert(!curried<takes_unique_t, int, std::unique_ptr<int>&, int>);
+static_assert(!std::is_invocable_v<takes_unique_t, std::unique_ptr<int>&>);
+static_assert(std::is_invocable_v<takes_unique_t, std::unique_ptr<int>>);
+
+//Applying a stateful lambda through an lvalue curry binds a copy of it, so the partial application can outlive the curry
+//Nothing asks about the lambda's type before the curry is applied, which is how a reference could previously end up bound instead
+auto partial_of_stateful_lambda()
+{
+	auto offset = [k = 40](int x, int y) { return k + x + y; };
+	auto c = curry{offset};
+	return c(1);
+}
+
+auto partial_of_const_stateful_lambda()
+{
+	auto const c = curry{[k = 40, l = 0L](int x, int y) { return k + int(l) + x + y; }};
+	return c(1);
+}
+static_assert(sizeof(decltype(partial_of_stateful_lambda())) == 2 * sizeof(int));
 
 auto expr(int a, int b)
 {
@@ -54,5 +125,17 @@ int main()
 
 	std::function<int(int,int)> f2 = curry{expr}(1)(2); //does *not* construct a new std::function
 
-	char c; std::cin >> c;
+	if(int(partial_of_stateful_lambda()(1)) != 42 || int(partial_of_const_stateful_lambda()(1)) != 42)
+	{
+		std::cout << "a partial application returned from a function referred to a curry that no longer exists\n";
+		return 1;
+	}
+
+	curry<counting_add> counting{counting_add{}};
+	counting_add original;
+	if(int(counting(1)(2)) != 3 || uncurry(counting).calls != 0 || int(curry{std::ref(original)}(1)(2)) != 3 || original.calls != 1)
+	{
+		std::cout << "applying a callable with mutable state through an lvalue didn't change a copy, or std::ref didn't change the original\n";
+		return 1;
+	}
 }
\ No newline at end of file
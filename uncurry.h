@@ -6,32 +6,35 @@ uncurry: A function to extract the value wrapped by a curried
 uncurried_t: a using template to get the type wrapped by a curried
 
 uncurried: the specialized struct used to implement uncurried_t
+
+curry_apply: applies the elements of a tuple (or anything tuple-like) to a curry as a single application
 */
 
 
 #pragma once
+#include<tuple>
 #include "curry.h"
 
 template<typename t>
-constexpr t& uncurry(curry<t>& f)
+constexpr t& uncurry(curry<t>& f) noexcept
 {
 	return f;
 }
 
 template<typename t>
-constexpr t const& uncurry(curry<t> const& f)
+constexpr t const& uncurry(curry<t> const& f) noexcept
 {
 	return f;
 }
 
 template<typename t>
-constexpr t&& uncurry(curry<t>&& f)
+constexpr t&& uncurry(curry<t>&& f) noexcept
 {
 	return std::move(f);
 }
 
 template<typename t>
-constexpr t const&& uncurry(curry<t> const&& f)
+constexpr t const&& uncurry(curry<t> const&& f) noexcept
 {
 	return std::move(f);
 }
@@ -47,3 +50,31 @@ struct uncurried<curry<t>>
 
 template<typename t>
 using uncurried_t = typename uncurried<t>::type;
+
+//curry_apply(f, args) is f(std::get<0>(args), std::get<1>(args), ...), with each element forwarded with the value category of args
+//So all of the elements are applied in one step, split wherever they saturate f, and any left over after that are bound in one partial application
+//As with std::apply, an empty tuple results in a unit application f()
+//Not named apply, since argument dependent lookup would make calls with a std::tuple ambiguous with std::apply
+template<typename t, typename args_t>
+constexpr auto curry_apply(curry<t>& f, args_t&& args) noexcept(noexcept(std::apply(f, std::forward<args_t>(args))))
+{
+	return std::apply(f, std::forward<args_t>(args));
+}
+
+template<typename t, typename args_t>
+constexpr auto curry_apply(curry<t> const& f, args_t&& args) noexcept(noexcept(std::apply(f, std::forward<args_t>(args))))
+{
+	return std::apply(f, std::forward<args_t>(args));
+}
+
+template<typename t, typename args_t>
+constexpr auto curry_apply(curry<t>&& f, args_t&& args) noexcept(noexcept(std::apply(std::move(f), std::forward<args_t>(args))))
+{
+	return std::apply(std::move(f), std::forward<args_t>(args));
+}
+
+template<typename t, typename args_t>
+constexpr auto curry_apply(curry<t> const&& f, args_t&& args) noexcept(noexcept(std::apply(std::move(f), std::forward<args_t>(args))))
+{
+	return std::apply(std::move(f), std::forward<args_t>(args));
+}